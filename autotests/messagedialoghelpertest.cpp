@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "messagedialoghelper.h"
+
+#include <KConfig>
+#include <KConfigGroup>
+#include <QTemporaryDir>
+#include <QTest>
+
+class MessageDialogHelperTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testDecisions()
+    {
+        QTemporaryDir dir;
+        KConfig config(dir.filePath(QStringLiteral("testrc")), KConfig::SimpleConfig);
+        MessageDialogHelper helper;
+        helper.setConfig(&config);
+
+        QVERIFY(helper.shouldBeShownContinue(QStringLiteral("continue")));
+        QVERIFY(helper.shouldBeShownTwoActions(QStringLiteral("twoActions")).value(QLatin1String("show")).toBool());
+
+        helper.saveDontShowAgainContinue(QStringLiteral("continue"));
+        helper.saveDontShowAgainTwoActions(QStringLiteral("twoActions"), true);
+        QVERIFY(!helper.shouldBeShownContinue(QStringLiteral("continue")));
+        const QJsonObject twoActions = helper.shouldBeShownTwoActions(QStringLiteral("twoActions"));
+        QVERIFY(!twoActions.value(QLatin1String("show")).toBool());
+        QVERIFY(twoActions.value(QLatin1String("result")).toBool());
+    }
+
+    void testReset()
+    {
+        QTemporaryDir dir;
+        KConfig config(dir.filePath(QStringLiteral("testrc")), KConfig::SimpleConfig);
+        MessageDialogHelper helper;
+        helper.setConfig(&config);
+
+        helper.saveDontShowAgainContinue(QStringLiteral("continue"));
+        QVERIFY(!helper.shouldBeShownContinue(QStringLiteral("continue")));
+
+        // What KMessageBox::enableAllMessages() does.
+        config.group(QStringLiteral("Notification Messages")).deleteGroup();
+        QVERIFY(helper.shouldBeShownContinue(QStringLiteral("continue")));
+    }
+
+    void testSaved()
+    {
+        QTemporaryDir dir;
+        const QString fileName = dir.filePath(QStringLiteral("testrc"));
+        {
+            KConfig config(fileName, KConfig::SimpleConfig);
+            MessageDialogHelper helper;
+            helper.setConfig(&config);
+            helper.saveDontShowAgainTwoActions(QStringLiteral("twoActions"), false);
+            // Pending writes are saved when the helper goes away.
+        }
+
+        KConfig config(fileName, KConfig::SimpleConfig);
+        QCOMPARE(config.group(QStringLiteral("Notification Messages")).readEntry("twoActions", QString()), QStringLiteral("false"));
+    }
+};
+
+QTEST_GUILESS_MAIN(MessageDialogHelperTest)
+
+#include "messagedialoghelpertest.moc"
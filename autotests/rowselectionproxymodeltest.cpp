@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "rowselectionproxymodel.h"
+
+#include <QAbstractListModel>
+#include <QSignalSpy>
+#include <QStandardItemModel>
+#include <QTest>
+
+namespace
+{
+// Rows of a single column whose roles can change on reset.
+class RolesModel : public QAbstractListModel
+{
+public:
+    int rowCount(const QModelIndex &parent = {}) const override
+    {
+        return parent.isValid() ? 0 : 4;
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        return role == Qt::DisplayRole ? QVariant(index.row()) : QVariant();
+    }
+
+    QHash<int, QByteArray> roleNames() const override
+    {
+        auto roles = QAbstractListModel::roleNames();
+        for (int i = 0; i < m_extraRoles; ++i) {
+            roles.insert(Qt::UserRole + 1 + i, "extra" + QByteArray::number(i));
+        }
+        return roles;
+    }
+
+    void setExtraRoles(int extraRoles)
+    {
+        beginResetModel();
+        m_extraRoles = extraRoles;
+        endResetModel();
+    }
+
+private:
+    int m_extraRoles = 0;
+};
+
+int rowSelectedRole(const QAbstractItemModel &model)
+{
+    return model.roleNames().key(QByteArrayLiteral("rowSelected"), -1);
+}
+}
+
+class RowSelectionProxyModelTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testRoleAfterSourceRoles()
+    {
+        RolesModel source;
+        source.setExtraRoles(2);
+        RowSelectionProxyModel proxy;
+        proxy.setSourceModel(&source);
+        QCOMPARE(rowSelectedRole(proxy), Qt::UserRole + 3);
+    }
+
+    void testRoleUpdatedBeforeReset()
+    {
+        RolesModel source;
+        RowSelectionProxyModel proxy;
+        proxy.setSourceModel(&source);
+        QCOMPARE(rowSelectedRole(proxy), Qt::UserRole + 1);
+
+        // Views read roleNames() again from modelReset, it has to be right by then.
+        int roleOnReset = -1;
+        connect(&proxy, &QAbstractItemModel::modelReset, this, [&] {
+            roleOnReset = rowSelectedRole(proxy);
+        });
+        source.setExtraRoles(3);
+        QCOMPARE(roleOnReset, Qt::UserRole + 4);
+        QVERIFY(!source.roleNames().contains(roleOnReset));
+    }
+
+    void testRoleUpdatedOnSourceChange()
+    {
+        RolesModel first;
+        RolesModel second;
+        second.setExtraRoles(1);
+        RowSelectionProxyModel proxy;
+        proxy.setSourceModel(&first);
+
+        int roleOnReset = -1;
+        connect(&proxy, &QAbstractItemModel::modelReset, this, [&] {
+            roleOnReset = rowSelectedRole(proxy);
+        });
+        proxy.setSourceModel(&second);
+        QCOMPARE(roleOnReset, Qt::UserRole + 2);
+    }
+
+    void testRowSelected()
+    {
+        QStandardItemModel source(5, 3);
+        QItemSelectionModel selectionModel(&source);
+        RowSelectionProxyModel proxy;
+        proxy.setSourceModel(&source);
+        proxy.setSelectionModel(&selectionModel);
+        const int role = rowSelectedRole(proxy);
+
+        selectionModel.select(source.index(2, 0), QItemSelectionModel::Select | QItemSelectionModel::Rows);
+        QCOMPARE(proxy.index(2, 1).data(role).toBool(), true);
+        QCOMPARE(proxy.index(1, 0).data(role).toBool(), false);
+
+        // Only the first column decides.
+        selectionModel.select(source.index(3, 2), QItemSelectionModel::Select);
+        QCOMPARE(proxy.index(3, 0).data(role).toBool(), false);
+    }
+
+    void testChangedRowsMerged()
+    {
+        QStandardItemModel source(10, 2);
+        QItemSelectionModel selectionModel(&source);
+        RowSelectionProxyModel proxy;
+        proxy.setSourceModel(&source);
+        proxy.setSelectionModel(&selectionModel);
+        const int role = rowSelectedRole(proxy);
+
+        QSignalSpy spy(&proxy, &QAbstractItemModel::dataChanged);
+        QItemSelection selection;
+        selection.select(source.index(1, 0), source.index(2, 1));
+        selection.select(source.index(3, 0), source.index(3, 0));
+        selection.select(source.index(7, 0), source.index(8, 0));
+        selectionModel.select(selection, QItemSelectionModel::Select);
+
+        QCOMPARE(spy.size(), 2);
+        QCOMPARE(spy.at(0).at(0).toModelIndex(), proxy.index(1, 0));
+        QCOMPARE(spy.at(0).at(1).toModelIndex(), proxy.index(3, 1));
+        QCOMPARE(spy.at(0).at(2).value<QList<int>>(), QList<int>{role});
+        QCOMPARE(spy.at(1).at(0).toModelIndex(), proxy.index(7, 0));
+        QCOMPARE(spy.at(1).at(1).toModelIndex(), proxy.index(8, 1));
+    }
+};
+
+QTEST_GUILESS_MAIN(RowSelectionProxyModelTest)
+
+#include "rowselectionproxymodeltest.moc"
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "settingssearchindex.h"
+
+#include <QSignalSpy>
+#include <QTest>
+
+#include <memory>
+#include <vector>
+
+using namespace Qt::StringLiterals;
+
+class SettingsSearchIndexTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    // Stands for a ConfigurationModule, the index only reads its properties.
+    QObject *addModule(const QString &text, const QString &category = {}, const QStringList &keywords = {})
+    {
+        auto &module = m_modules.emplace_back(std::make_unique<QObject>());
+        module->setProperty("text", text);
+        module->setProperty("category", category.isEmpty() ? u"_main_category"_s : category);
+        module->setProperty("keywords", keywords);
+        return module.get();
+    }
+
+    QList<QObject *> modules() const
+    {
+        QList<QObject *> modules;
+        for (const auto &module : m_modules) {
+            modules.append(module.get());
+        }
+        return modules;
+    }
+
+    std::vector<std::unique_ptr<QObject>> m_modules;
+
+private Q_SLOTS:
+    void cleanup()
+    {
+        m_modules.clear();
+    }
+
+    void testPrefixes()
+    {
+        addModule(u"General"_s, {}, {u"Font size"_s});
+        addModule(u"Appearance"_s, u"Look and feel"_s);
+        addModule(u"Font colors"_s);
+        SettingsSearchIndex index;
+        index.setModules(modules());
+
+        QCOMPARE(index.search(QString()), (QList<int>{0, 1, 2}));
+        QCOMPARE(index.search(u"FONT"_s), (QList<int>{0, 2}));
+        QCOMPARE(index.search(u"fo si"_s), QList<int>{0});
+        QCOMPARE(index.search(u"feel"_s), QList<int>{1});
+        // Modules in the default category are not found by its name.
+        QCOMPARE(index.search(u"_main"_s), QList<int>{});
+    }
+
+    void testInsideWords()
+    {
+        addModule(u"Resize windows"_s);
+        addModule(u"Sizes"_s);
+        SettingsSearchIndex index;
+        index.setModules(modules());
+
+        // Words starting with the query are preferred.
+        QCOMPARE(index.search(u"size"_s), QList<int>{1});
+        QCOMPARE(index.search(u"esiz"_s), QList<int>{0});
+    }
+
+    void testWithoutWordBreaks()
+    {
+        addModule(u"字体大小"_s);
+        addModule(u"大小写"_s);
+        addModule(u"Qt设置"_s);
+        SettingsSearchIndex index;
+        index.setModules(modules());
+
+        QCOMPARE(index.search(u"大小"_s), (QList<int>{0, 1}));
+        QCOMPARE(index.search(u"体大"_s), QList<int>{0});
+        QCOMPARE(index.search(u"设置"_s), QList<int>{2});
+        QCOMPARE(index.search(u"qt"_s), QList<int>{2});
+    }
+
+    void testRevision()
+    {
+        addModule(u"General"_s);
+        SettingsSearchIndex index;
+        QSignalSpy spy(&index, &SettingsSearchIndex::revisionChanged);
+
+        // Changes made together give a single new revision.
+        index.setModules(modules());
+        index.setModules({});
+        index.setModules(modules());
+        QCOMPARE(spy.size(), 0);
+        QTRY_COMPARE(spy.size(), 1);
+        QCOMPARE(index.revision(), 1);
+    }
+
+    void testPropertyChanges()
+    {
+        QObject *module = addModule(u"General"_s);
+        SettingsSearchIndex index;
+        index.setModules(modules());
+        QCOMPARE(index.search(u"gen"_s), QList<int>{0});
+
+        // Dynamic properties have no notify signal, set the modules again to rebuild.
+        module->setProperty("text", u"Allgemein"_s);
+        index.setModules({});
+        index.setModules(modules());
+        QCOMPARE(index.search(u"gen"_s), QList<int>{});
+        QCOMPARE(index.search(u"allg"_s), QList<int>{0});
+    }
+};
+
+QTEST_GUILESS_MAIN(SettingsSearchIndexTest)
+
+#include "settingssearchindextest.moc"
@@ -0,0 +1,362 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "soundmetadata.h"
+
+#include <QFile>
+#include <QStandardPaths>
+#include <QTemporaryDir>
+#include <QTest>
+#include <QTimeZone>
+#include <QtEndian>
+
+namespace
+{
+QByteArray le16(quint16 value)
+{
+    QByteArray bytes(2, Qt::Uninitialized);
+    qToLittleEndian(value, bytes.data());
+    return bytes;
+}
+
+QByteArray le32(quint32 value)
+{
+    QByteArray bytes(4, Qt::Uninitialized);
+    qToLittleEndian(value, bytes.data());
+    return bytes;
+}
+
+QByteArray le64(quint64 value)
+{
+    QByteArray bytes(8, Qt::Uninitialized);
+    qToLittleEndian(value, bytes.data());
+    return bytes;
+}
+
+QByteArray be24(quint32 value)
+{
+    const char bytes[] = {char(value >> 16), char(value >> 8), char(value)};
+    return QByteArray(bytes, sizeof(bytes));
+}
+
+QByteArray vorbisComment(const QByteArray &title)
+{
+    const QByteArray vendor = "test";
+    const QByteArray comment = "TITLE=" + title;
+    return le32(vendor.size()) + vendor + le32(1) + le32(comment.size()) + comment;
+}
+
+// 16 bits PCM, 1 second per byteRate bytes of data.
+QByteArray wav(int channels, int sampleRate, int dataSize, const QByteArray &title = {})
+{
+    const int byteRate = sampleRate * channels * 2;
+    QByteArray fmt = le16(1) + le16(channels) + le32(sampleRate) + le32(byteRate) + le16(channels * 2) + le16(16);
+    QByteArray body = "WAVE" + QByteArray("fmt ") + le32(fmt.size()) + fmt;
+    if (!title.isEmpty()) {
+        QByteArray name = title + '\0';
+        if (name.size() & 1) {
+            name += '\0';
+        }
+        const QByteArray info = "INFO" + QByteArray("INAM") + le32(name.size()) + name;
+        body += "LIST" + le32(info.size()) + info;
+    }
+    body += "data" + le32(dataSize) + QByteArray(dataSize, '\0');
+    return "RIFF" + le32(body.size()) + body;
+}
+
+QByteArray flac(int channels, int sampleRate, quint64 totalSamples, const QByteArray &title = {})
+{
+    const int bitsPerSample = 16;
+    QByteArray streamInfo(10, '\0'); // block and frame sizes
+    streamInfo += char(sampleRate >> 12);
+    streamInfo += char(sampleRate >> 4);
+    streamInfo += char(((sampleRate & 0x0f) << 4) | ((channels - 1) << 1) | ((bitsPerSample - 1) >> 4));
+    streamInfo += char((((bitsPerSample - 1) & 0x0f) << 4) | ((totalSamples >> 32) & 0x0f));
+    QByteArray samples(4, Qt::Uninitialized);
+    qToBigEndian(quint32(totalSamples), samples.data());
+    streamInfo += samples;
+    streamInfo += QByteArray(16, '\0'); // MD5
+
+    QByteArray data = "fLaC";
+    data += char(title.isEmpty() ? 0x80 : 0x00) + be24(streamInfo.size()) + streamInfo;
+    if (!title.isEmpty()) {
+        const QByteArray comment = vorbisComment(title);
+        data += char(0x84) + be24(comment.size()) + comment;
+    }
+    return data + QByteArray(64, '\0'); // frames
+}
+
+QByteArray oggPage(quint64 granule, quint32 sequence, const QByteArray &packet)
+{
+    QByteArray lacing;
+    qsizetype remaining = packet.size();
+    while (remaining >= 255) {
+        lacing += char(255);
+        remaining -= 255;
+    }
+    lacing += char(remaining);
+    return "OggS" + QByteArray(2, '\0') + le64(granule) + le32(1) + le32(sequence) + le32(0) + char(lacing.size()) + lacing + packet;
+}
+
+QByteArray oggVorbis(int channels, int sampleRate, quint64 samples, const QByteArray &title)
+{
+    const QByteArray identification = "\x01vorbis" + le32(0) + char(channels) + le32(sampleRate) + le32(0) + le32(128000) + le32(0) + char(0xb8) + char(1);
+    const QByteArray comments = "\x03vorbis" + vorbisComment(title) + char(1);
+    return oggPage(0, 0, identification) + oggPage(0, 1, comments) + oggPage(samples, 2, QByteArray(100, '\0'));
+}
+
+QByteArray opus(int channels, quint16 preSkip, quint64 granule, const QByteArray &title)
+{
+    const QByteArray head = "OpusHead" + QByteArray(1, char(1)) + char(channels) + le16(preSkip) + le32(44100) + le16(0) + char(0);
+    const QByteArray tags = "OpusTags" + vorbisComment(title);
+    return oggPage(0, 0, head) + oggPage(0, 1, tags) + oggPage(granule, 2, QByteArray(100, '\0'));
+}
+}
+
+class SoundMetadataTest : public QObject
+{
+    Q_OBJECT
+
+private:
+    QString write(const QByteArray &data)
+    {
+        const QString fileName = m_dir.filePath(QStringLiteral("sound%1").arg(m_fileCount++));
+        QFile file(fileName);
+        if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size()) {
+            qFatal("Unable to write test file");
+        }
+        return fileName;
+    }
+
+    QTemporaryDir m_dir;
+    int m_fileCount = 0;
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        QStandardPaths::setTestModeEnabled(true);
+        QVERIFY(m_dir.isValid());
+    }
+
+    void testWav()
+    {
+        const auto metadata = readSoundMetadata(write(wav(2, 44100, 44100 * 4 * 2, "Bell")));
+        QVERIFY(metadata.isValid());
+        QCOMPARE(metadata.channelCount, 2);
+        QCOMPARE(metadata.sampleRate, 44100);
+        QCOMPARE(metadata.duration, 2000);
+        QCOMPARE(metadata.title, QStringLiteral("Bell"));
+    }
+
+    void testWavStreamingDataSize()
+    {
+        // Writers that do not know the length leave 0xFFFFFFFF, the data runs to the end of the file.
+        QByteArray data = wav(1, 8000, 16000);
+        data.replace(data.indexOf("data") + 4, 4, le32(0xFFFFFFFF));
+        const auto metadata = readSoundMetadata(write(data));
+        QCOMPARE(metadata.duration, 1000);
+    }
+
+    void testWavOversizedChunks()
+    {
+        // A LIST chunk claiming more bytes than the file has must not be read past the end.
+        QByteArray data = wav(1, 8000, 16000, "Bell");
+        data.replace(data.indexOf("LIST") + 4, 4, le32(0x7FFFFFFF));
+        const auto metadata = readSoundMetadata(write(data));
+        QCOMPARE(metadata.sampleRate, 8000);
+        QCOMPARE(metadata.duration, -1);
+    }
+
+    void testFlac()
+    {
+        const auto metadata = readSoundMetadata(write(flac(2, 48000, 48000 * 3, "Chime")));
+        QVERIFY(metadata.isValid());
+        QCOMPARE(metadata.channelCount, 2);
+        QCOMPARE(metadata.sampleRate, 48000);
+        QCOMPARE(metadata.duration, 3000);
+        QCOMPARE(metadata.title, QStringLiteral("Chime"));
+    }
+
+    void testFlacAfterId3()
+    {
+        // ID3v2 header with a 16 bytes tag, its size is stored as 7 bits per byte.
+        const QByteArray id3 = "ID3" + QByteArray("\x04\x00\x00\x00\x00\x00\x10", 7) + QByteArray(16, '\0');
+        const auto metadata = readSoundMetadata(write(id3 + flac(1, 22050, 22050)));
+        QCOMPARE(metadata.sampleRate, 22050);
+        QCOMPARE(metadata.duration, 1000);
+    }
+
+    void testFlacOversizedComment()
+    {
+        QByteArray data = flac(2, 48000, 48000, "Chime");
+        const auto comment = data.indexOf(char(0x84));
+        data.replace(comment + 1, 3, be24(0xFFFFFF));
+        const auto metadata = readSoundMetadata(write(data));
+        QCOMPARE(metadata.sampleRate, 48000);
+        QVERIFY(metadata.title.isEmpty());
+    }
+
+    void testOggVorbis()
+    {
+        const auto metadata = readSoundMetadata(write(oggVorbis(2, 44100, 44100 * 5, "Drip")));
+        QVERIFY(metadata.isValid());
+        QCOMPARE(metadata.channelCount, 2);
+        QCOMPARE(metadata.sampleRate, 44100);
+        QCOMPARE(metadata.duration, 5000);
+        QCOMPARE(metadata.title, QStringLiteral("Drip"));
+    }
+
+    void testOggVorbisLongVendor()
+    {
+        // A vendor string length running past the packet leaves the title empty, the rest is still read.
+        QByteArray data = oggVorbis(1, 44100, 44100, "Drip");
+        data.replace(data.indexOf("\x03vorbis") + 7, 4, le32(0x7FFFFFFF));
+        const auto metadata = readSoundMetadata(write(data));
+        QCOMPARE(metadata.sampleRate, 44100);
+        QVERIFY(metadata.title.isEmpty());
+    }
+
+    void testOpus()
+    {
+        const auto metadata = readSoundMetadata(write(opus(2, 312, 48000 * 2 + 312, "Pop")));
+        QVERIFY(metadata.isValid());
+        QCOMPARE(metadata.channelCount, 2);
+        QCOMPARE(metadata.sampleRate, 44100);
+        QCOMPARE(metadata.duration, 2000);
+        QCOMPARE(metadata.title, QStringLiteral("Pop"));
+    }
+
+    void testTruncated_data()
+    {
+        QTest::addColumn<QByteArray>("data");
+        QTest::addColumn<qsizetype>("headerSize");
+
+        // headerSize is the number of bytes needed to know the sample rate.
+        QTest::newRow("wav") << wav(2, 44100, 400, "Bell") << qsizetype(12 + 8 + 16);
+        QTest::newRow("flac") << flac(2, 48000, 48000, "Chime") << qsizetype(4 + 4 + 18);
+        QTest::newRow("vorbis") << oggVorbis(2, 44100, 44100, "Drip") << qsizetype(27 + 1 + 30);
+        QTest::newRow("opus") << opus(2, 312, 48000, "Pop") << qsizetype(27 + 1 + 19);
+    }
+
+    void testTruncated()
+    {
+        QFETCH(QByteArray, data);
+        QFETCH(qsizetype, headerSize);
+
+        // Every prefix of the file must be parsed without reading out of bounds.
+        for (qsizetype size = 0; size < data.size(); ++size) {
+            const auto metadata = readSoundMetadata(write(data.left(size)));
+            if (size < headerSize) {
+                QVERIFY2(!metadata.isValid(), qPrintable(QStringLiteral("size %1").arg(size)));
+            }
+            QVERIFY(metadata.duration >= -1);
+        }
+    }
+
+    void testGarbage()
+    {
+        QCOMPARE(readSoundMetadata(write(QByteArray(4096, '\xff'))).isValid(), false);
+        QCOMPARE(readSoundMetadata(write("RIFF\xff\xff\xff\xffWAVEfmt \xff\xff\xff\xff")).isValid(), false);
+        QCOMPARE(readSoundMetadata(write("OggS" + QByteArray(23, '\0') + QByteArray(255, '\xff'))).isValid(), false);
+        QCOMPARE(readSoundMetadata(m_dir.filePath(QStringLiteral("missing"))).isValid(), false);
+    }
+
+    void testIndexRoundTrip()
+    {
+        const QDateTime lastModified = QDateTime::fromMSecsSinceEpoch(1700000000000, QTimeZone::UTC);
+        {
+            SoundMetadataIndex index;
+            index.load();
+            QVERIFY(!index.isDirty());
+            index.insert(QStringLiteral("/sounds/bell.wav"), {1234, lastModified, {2000, 2, 44100, QStringLiteral("Bell")}});
+            index.insert(QStringLiteral("/sounds/chime.flac"), {99, lastModified, {}});
+            QVERIFY(index.isDirty());
+            index.save();
+            QVERIFY(!index.isDirty());
+        }
+
+        SoundMetadataIndex index;
+        index.load();
+        const auto bell = index.entry(QStringLiteral("/sounds/bell.wav"));
+        QCOMPARE(bell.size, 1234);
+        QCOMPARE(bell.lastModified, lastModified);
+        QCOMPARE(bell.metadata.duration, 2000);
+        QCOMPARE(bell.metadata.channelCount, 2);
+        QCOMPARE(bell.metadata.sampleRate, 44100);
+        QCOMPARE(bell.metadata.title, QStringLiteral("Bell"));
+
+        const auto chime = index.entry(QStringLiteral("/sounds/chime.flac"));
+        QCOMPARE(chime.size, 99);
+        QVERIFY(!chime.metadata.isValid());
+
+        QCOMPARE(index.entry(QStringLiteral("/sounds/missing.ogg")).size, -1);
+    }
+
+    void testIndexDamaged_data()
+    {
+        QTest::addColumn<QByteArray>("data");
+
+        QTest::newRow("empty") << QByteArray();
+        QTest::newRow("wrong magic") << QByteArray("garbage garbage garbage");
+        QTest::newRow("wrong version") << QByteArray::fromHex("534E4458000000ff00000001");
+        QTest::newRow("negative count") << QByteArray::fromHex("534E445800000001ffffffff");
+        QTest::newRow("huge count") << QByteArray::fromHex("534E4458000000017fffffff0000");
+    }
+
+    void testIndexDamaged()
+    {
+        QFETCH(QByteArray, data);
+
+        // Write a valid index first, to find out where it lives.
+        {
+            SoundMetadataIndex index;
+            index.insert(QStringLiteral("/sounds/bell.wav"), {1, {}, {}});
+            index.save();
+        }
+        const QString fileName = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + QStringLiteral("/lingmoui-addons/soundmetadata.index");
+        QFile file(fileName);
+        QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        file.write(data);
+        file.close();
+
+        SoundMetadataIndex index;
+        index.load();
+        QCOMPARE(index.entry(QStringLiteral("/sounds/bell.wav")).size, -1);
+        QVERIFY(!index.isDirty());
+    }
+
+    void testIndexTruncated()
+    {
+        {
+            SoundMetadataIndex index;
+            for (int i = 0; i < 10; ++i) {
+                index.insert(QStringLiteral("/sounds/%1.wav").arg(i), {i, {}, {1000, 1, 8000, {}}});
+            }
+            index.save();
+        }
+        const QString fileName = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + QStringLiteral("/lingmoui-addons/soundmetadata.index");
+        QFile file(fileName);
+        QVERIFY(file.open(QIODevice::ReadWrite));
+        const QByteArray data = file.readAll();
+        file.resize(data.size() / 2);
+        file.close();
+
+        // The entries before the cut are kept, the rest is dropped.
+        SoundMetadataIndex index;
+        index.load();
+        int found = 0;
+        for (int i = 0; i < 10; ++i) {
+            const auto entry = index.entry(QStringLiteral("/sounds/%1.wav").arg(i));
+            if (entry.size >= 0) {
+                QCOMPARE(entry.size, i);
+                QCOMPARE(entry.metadata.duration, 1000);
+                ++found;
+            }
+        }
+        QVERIFY(found < 10);
+    }
+};
+
+QTEST_GUILESS_MAIN(SoundMetadataTest)
+
+#include "soundmetadatatest.moc"
@@ -0,0 +1,249 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "tablecolumnorderproxymodel.h"
+
+#include <QAbstractItemModelTester>
+#include <QAbstractTableModel>
+#include <QSignalSpy>
+#include <QStandardItemModel>
+#include <QTest>
+
+namespace
+{
+// Rows of three columns holding row * 10 + column, whose rows can be moved.
+class MovableModel : public QAbstractTableModel
+{
+public:
+    explicit MovableModel(int rows)
+    {
+        for (int row = 0; row < rows; ++row) {
+            m_rows.append(row);
+        }
+    }
+
+    int rowCount(const QModelIndex &parent = {}) const override
+    {
+        return parent.isValid() ? 0 : m_rows.size();
+    }
+
+    int columnCount(const QModelIndex &parent = {}) const override
+    {
+        return parent.isValid() ? 0 : 3;
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        return role == Qt::DisplayRole ? QVariant(m_rows.at(index.row()) * 10 + index.column()) : QVariant();
+    }
+
+    bool moveRows(const QModelIndex &sourceParent, int sourceRow, int count, const QModelIndex &destinationParent, int destinationChild) override
+    {
+        if (!beginMoveRows(sourceParent, sourceRow, sourceRow + count - 1, destinationParent, destinationChild)) {
+            return false;
+        }
+        const QList<int> moved = m_rows.mid(sourceRow, count);
+        m_rows.remove(sourceRow, count);
+        const int destination = destinationChild > sourceRow ? destinationChild - count : destinationChild;
+        for (int i = 0; i < count; ++i) {
+            m_rows.insert(destination + i, moved.at(i));
+        }
+        endMoveRows();
+        return true;
+    }
+
+private:
+    QList<int> m_rows;
+};
+
+// A table of rows * columns items holding row * 10 + column.
+void fill(QStandardItemModel &model, int rows, int columns)
+{
+    model.setRowCount(rows);
+    model.setColumnCount(columns);
+    for (int row = 0; row < rows; ++row) {
+        for (int column = 0; column < columns; ++column) {
+            model.setItem(row, column, new QStandardItem(QString::number(row * 10 + column)));
+        }
+    }
+}
+
+int valueAt(const QAbstractItemModel &model, int row, int column)
+{
+    return model.index(row, column).data().toInt();
+}
+}
+
+class TableColumnOrderProxyModelTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testMapping()
+    {
+        QStandardItemModel source;
+        fill(source, 3, 4);
+        TableColumnOrderProxyModel proxy;
+        proxy.setSourceModel(&source);
+        QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+        QCOMPARE(proxy.columnCount(), 4);
+        QCOMPARE(valueAt(proxy, 1, 2), 12);
+
+        // Unknown and repeated columns are left out, the others hidden.
+        proxy.setColumns({3, 7, 0, 3});
+        QCOMPARE(proxy.columnCount(), 2);
+        QCOMPARE(valueAt(proxy, 1, 0), 13);
+        QCOMPARE(valueAt(proxy, 1, 1), 10);
+        QCOMPARE(proxy.mapToSource(proxy.index(2, 0)), source.index(2, 3));
+        QCOMPARE(proxy.mapFromSource(source.index(2, 0)), proxy.index(2, 1));
+        QVERIFY(!proxy.mapFromSource(source.index(2, 1)).isValid());
+
+        source.setHorizontalHeaderLabels({QStringLiteral("a"), QStringLiteral("b"), QStringLiteral("c"), QStringLiteral("d")});
+        QCOMPARE(proxy.headerData(0, Qt::Horizontal).toString(), QStringLiteral("d"));
+    }
+
+    void testSetColumnsKeepsPersistentIndexes()
+    {
+        QStandardItemModel source;
+        fill(source, 3, 3);
+        TableColumnOrderProxyModel proxy;
+        proxy.setSourceModel(&source);
+        QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+        const QPersistentModelIndex index = proxy.index(1, 0);
+        QSignalSpy layoutSpy(&proxy, &QAbstractItemModel::layoutChanged);
+        QSignalSpy resetSpy(&proxy, &QAbstractItemModel::modelReset);
+        proxy.setColumns({2, 1, 0});
+        QCOMPARE(layoutSpy.size(), 1);
+        QCOMPARE(resetSpy.size(), 0);
+        QCOMPARE(index.column(), 2);
+        QCOMPARE(index.data().toInt(), 10);
+    }
+
+    void testDataChangedMapped()
+    {
+        QStandardItemModel source;
+        fill(source, 3, 4);
+        TableColumnOrderProxyModel proxy;
+        proxy.setSourceModel(&source);
+        proxy.setColumns({2, 0, 1});
+
+        // A single cell stays a single cell.
+        QSignalSpy spy(&proxy, &QAbstractItemModel::dataChanged);
+        source.item(1, 0)->setText(QStringLiteral("x"));
+        QCOMPARE(spy.size(), 1);
+        QCOMPARE(spy.at(0).at(0).toModelIndex(), proxy.index(1, 1));
+        QCOMPARE(spy.at(0).at(1).toModelIndex(), proxy.index(1, 1));
+
+        // Source columns 1 to 3 are shown as 2 and 0, column 3 is hidden.
+        spy.clear();
+        Q_EMIT source.dataChanged(source.index(0, 1), source.index(2, 3));
+        QCOMPARE(spy.size(), 2);
+        QCOMPARE(spy.at(0).at(0).toModelIndex(), proxy.index(0, 0));
+        QCOMPARE(spy.at(0).at(1).toModelIndex(), proxy.index(2, 0));
+        QCOMPARE(spy.at(1).at(0).toModelIndex(), proxy.index(0, 2));
+        QCOMPARE(spy.at(1).at(1).toModelIndex(), proxy.index(2, 2));
+
+        // Contiguous once mapped, a single signal.
+        spy.clear();
+        Q_EMIT source.dataChanged(source.index(0, 0), source.index(0, 1));
+        QCOMPARE(spy.size(), 1);
+        QCOMPARE(spy.at(0).at(0).toModelIndex(), proxy.index(0, 1));
+        QCOMPARE(spy.at(0).at(1).toModelIndex(), proxy.index(0, 2));
+    }
+
+    void testRowsForwarded()
+    {
+        QStandardItemModel source;
+        fill(source, 3, 2);
+        TableColumnOrderProxyModel proxy;
+        proxy.setSourceModel(&source);
+        proxy.setColumns({1, 0});
+        QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+        QSignalSpy insertSpy(&proxy, &QAbstractItemModel::rowsInserted);
+        QSignalSpy removeSpy(&proxy, &QAbstractItemModel::rowsRemoved);
+        QSignalSpy resetSpy(&proxy, &QAbstractItemModel::modelReset);
+        source.insertRow(1, {new QStandardItem(QStringLiteral("5")), new QStandardItem(QStringLiteral("6"))});
+        QCOMPARE(insertSpy.size(), 1);
+        QCOMPARE(proxy.rowCount(), 4);
+        QCOMPARE(valueAt(proxy, 1, 0), 6);
+
+        source.removeRows(0, 2);
+        QCOMPARE(removeSpy.size(), 1);
+        QCOMPARE(proxy.rowCount(), 2);
+        QCOMPARE(valueAt(proxy, 0, 1), 10);
+
+        // Child rows are not shown.
+        source.item(0, 0)->appendRow(new QStandardItem(QStringLiteral("7")));
+        QCOMPARE(insertSpy.size(), 1);
+        QCOMPARE(proxy.rowCount(proxy.index(0, 1)), 0);
+        QCOMPARE(resetSpy.size(), 0);
+    }
+
+    void testLayoutChangeForwarded()
+    {
+        QStandardItemModel source;
+        fill(source, 4, 3);
+        TableColumnOrderProxyModel proxy;
+        proxy.setSourceModel(&source);
+        proxy.setColumns({2, 0});
+        QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+        const QPersistentModelIndex index = proxy.index(1, 1);
+        QSignalSpy aboutSpy(&proxy, &QAbstractItemModel::layoutAboutToBeChanged);
+        QSignalSpy layoutSpy(&proxy, &QAbstractItemModel::layoutChanged);
+        QSignalSpy resetSpy(&proxy, &QAbstractItemModel::modelReset);
+        source.sort(0, Qt::DescendingOrder);
+
+        QCOMPARE(aboutSpy.size(), 1);
+        QCOMPARE(layoutSpy.size(), 1);
+        QCOMPARE(resetSpy.size(), 0);
+        QCOMPARE(valueAt(proxy, 0, 0), 32);
+        // The index follows its row.
+        QCOMPARE(index.row(), 2);
+        QCOMPARE(index.column(), 1);
+        QCOMPARE(index.data().toInt(), 10);
+    }
+
+    void testMoveForwarded()
+    {
+        MovableModel source(4);
+        TableColumnOrderProxyModel proxy;
+        proxy.setSourceModel(&source);
+        proxy.setColumns({1, 0});
+        QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+        const QPersistentModelIndex index = proxy.index(0, 0);
+        QSignalSpy moveSpy(&proxy, &QAbstractItemModel::rowsMoved);
+        QSignalSpy resetSpy(&proxy, &QAbstractItemModel::modelReset);
+        QVERIFY(source.moveRows({}, 0, 2, {}, 4));
+
+        QCOMPARE(moveSpy.size(), 1);
+        QCOMPARE(moveSpy.at(0).at(1).toInt(), 0);
+        QCOMPARE(moveSpy.at(0).at(2).toInt(), 1);
+        QCOMPARE(moveSpy.at(0).at(4).toInt(), 4);
+        QCOMPARE(resetSpy.size(), 0);
+        QCOMPARE(valueAt(proxy, 0, 0), 21);
+        QCOMPARE(index.row(), 2);
+        QCOMPARE(index.data().toInt(), 1);
+    }
+
+    void testColumnChangesReset()
+    {
+        QStandardItemModel source;
+        fill(source, 2, 2);
+        TableColumnOrderProxyModel proxy;
+        proxy.setSourceModel(&source);
+        QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+        QSignalSpy resetSpy(&proxy, &QAbstractItemModel::modelReset);
+        source.insertColumn(2);
+        QCOMPARE(resetSpy.size(), 1);
+        QCOMPARE(proxy.columnCount(), 3);
+    }
+};
+
+QTEST_GUILESS_MAIN(TableColumnOrderProxyModelTest)
+
+#include "tablecolumnorderproxymodeltest.moc"
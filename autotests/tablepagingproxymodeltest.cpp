@@ -0,0 +1,287 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "tablepagingproxymodel.h"
+
+#include <QAbstractItemModelTester>
+#include <QAbstractListModel>
+#include <QSignalSpy>
+#include <QTest>
+
+#include <algorithm>
+#include <vector>
+
+// Holds totalRows rows, of which pageSize more are inserted per fetchMore().
+class PagedModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    explicit PagedModel(int loadedRows, int totalRows, QObject *parent = nullptr)
+        : QAbstractListModel(parent)
+        , m_loadedRows(loadedRows)
+        , m_totalRows(totalRows)
+        , m_released(loadedRows, false)
+    {
+    }
+
+    int rowCount(const QModelIndex &parent = {}) const override
+    {
+        return parent.isValid() ? 0 : m_loadedRows;
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        if (role != Qt::DisplayRole || m_released[index.row()]) {
+            return {};
+        }
+        return index.row();
+    }
+
+    QHash<int, QByteArray> roleNames() const override
+    {
+        auto roles = QAbstractListModel::roleNames();
+        for (int i = 0; i < m_extraRoles; ++i) {
+            roles.insert(Qt::UserRole + 1 + i, "extra" + QByteArray::number(i));
+        }
+        return roles;
+    }
+
+    bool canFetchMore(const QModelIndex &parent) const override
+    {
+        return !parent.isValid() && m_loadedRows < m_totalRows;
+    }
+
+    void fetchMore(const QModelIndex &parent) override
+    {
+        Q_UNUSED(parent)
+        ++fetchCount;
+        if (synchronous) {
+            deliver();
+        }
+    }
+
+    void deliver()
+    {
+        const int rows = std::min(pageSize, m_totalRows - m_loadedRows);
+        beginInsertRows({}, m_loadedRows, m_loadedRows + rows - 1);
+        m_loadedRows += rows;
+        m_released.resize(m_loadedRows, false);
+        endInsertRows();
+    }
+
+    void setExtraRoles(int extraRoles)
+    {
+        beginResetModel();
+        m_extraRoles = extraRoles;
+        endResetModel();
+    }
+
+    bool isReleased(int row) const
+    {
+        return m_released[row];
+    }
+
+    bool synchronous = true;
+    int pageSize = 20;
+    int fetchCount = 0;
+
+protected:
+    int m_loadedRows;
+    int m_totalRows;
+    int m_extraRoles = 0;
+    std::vector<bool> m_released;
+};
+
+// Also implements the protocol letting the proxy drop rows far from the view.
+class ReleasingModel : public PagedModel
+{
+    Q_OBJECT
+
+public:
+    using PagedModel::PagedModel;
+
+    Q_INVOKABLE void releaseRows(int first, int last)
+    {
+        std::fill(m_released.begin() + first, m_released.begin() + last + 1, true);
+    }
+
+    Q_INVOKABLE void fetchRows(int first, int last)
+    {
+        std::fill(m_released.begin() + first, m_released.begin() + last + 1, false);
+        Q_EMIT dataChanged(index(first), index(last));
+    }
+};
+
+namespace
+{
+int placeholderRole(const QAbstractItemModel &model)
+{
+    return model.roleNames().key(QByteArrayLiteral("placeholder"), -1);
+}
+
+bool isPlaceholder(const QAbstractItemModel &model, int row)
+{
+    return model.index(row, 0).data(placeholderRole(model)).toBool();
+}
+}
+
+class TablePagingProxyModelTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testFetchNearEnd()
+    {
+        PagedModel source(20, 100);
+        TablePagingProxyModel proxy;
+        proxy.setFetchAhead(5);
+        proxy.setSourceModel(&source);
+        QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+        proxy.setFirstVisibleRow(0);
+        proxy.setLastVisibleRow(10);
+        QTest::qWait(10);
+        QCOMPARE(source.fetchCount, 0);
+
+        proxy.setLastVisibleRow(16);
+        QTRY_COMPARE(proxy.rowCount(), 40);
+        QCOMPARE(source.fetchCount, 1);
+        QVERIFY(!proxy.isLoading());
+        QVERIFY(!isPlaceholder(proxy, 39));
+    }
+
+    void testPlaceholdersWhileLoading()
+    {
+        PagedModel source(20, 100);
+        source.synchronous = false;
+        TablePagingProxyModel proxy;
+        proxy.setFetchAhead(5);
+        proxy.setPlaceholderCount(3);
+        proxy.setSourceModel(&source);
+        QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+        QSignalSpy loadingSpy(&proxy, &TablePagingProxyModel::loadingChanged);
+        proxy.setLastVisibleRow(18);
+        QTRY_VERIFY(proxy.isLoading());
+        QCOMPARE(proxy.rowCount(), 23);
+        QVERIFY(!isPlaceholder(proxy, 19));
+        QVERIFY(isPlaceholder(proxy, 20));
+        QVERIFY(isPlaceholder(proxy, 22));
+        QVERIFY(!proxy.index(21, 0).data().isValid());
+
+        source.deliver();
+        QVERIFY(!proxy.isLoading());
+        QCOMPARE(proxy.rowCount(), 40);
+        QVERIFY(!isPlaceholder(proxy, 20));
+        QCOMPARE(proxy.index(21, 0).data().toInt(), 21);
+        QCOMPARE(loadingSpy.size(), 2);
+    }
+
+    void testTimeoutWaitsForVisibleRows()
+    {
+        PagedModel source(20, 100);
+        source.synchronous = false;
+        TablePagingProxyModel proxy;
+        proxy.setFetchAhead(5);
+        proxy.setFetchTimeout(20);
+        proxy.setSourceModel(&source);
+        QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+        QSignalSpy loadingSpy(&proxy, &TablePagingProxyModel::loadingChanged);
+        proxy.setLastVisibleRow(18);
+        QTRY_COMPARE(loadingSpy.size(), 2);
+        QVERIFY(!proxy.isLoading());
+        QCOMPARE(proxy.rowCount(), 20);
+
+        // Not fetched again on its own.
+        QTest::qWait(100);
+        QCOMPARE(source.fetchCount, 1);
+        QVERIFY(!proxy.isLoading());
+
+        // Until the view moves.
+        proxy.setLastVisibleRow(19);
+        QTRY_COMPARE(source.fetchCount, 2);
+    }
+
+    void testLateRowsAfterTimeout()
+    {
+        PagedModel source(20, 100);
+        source.synchronous = false;
+        TablePagingProxyModel proxy;
+        proxy.setFetchAhead(50);
+        proxy.setFetchTimeout(20);
+        proxy.setSourceModel(&source);
+
+        QSignalSpy loadingSpy(&proxy, &TablePagingProxyModel::loadingChanged);
+        proxy.setLastVisibleRow(10);
+        QTRY_COMPARE(loadingSpy.size(), 2);
+
+        // The rows came in after all, the view still is close to the end.
+        source.deliver();
+        QCOMPARE(proxy.rowCount(), 40);
+        QTRY_COMPARE(source.fetchCount, 2);
+    }
+
+    void testPlaceholderRoleOnReset()
+    {
+        PagedModel source(5, 5);
+        TablePagingProxyModel proxy;
+        proxy.setSourceModel(&source);
+        QCOMPARE(placeholderRole(proxy), Qt::UserRole + 1);
+
+        int roleOnReset = -1;
+        connect(&proxy, &QAbstractItemModel::modelReset, this, [&] {
+            roleOnReset = placeholderRole(proxy);
+        });
+        source.setExtraRoles(2);
+        QCOMPARE(roleOnReset, Qt::UserRole + 3);
+    }
+
+    void testReleaseRows()
+    {
+        ReleasingModel source(100, 100);
+        TablePagingProxyModel proxy;
+        proxy.setSourceModel(&source);
+        proxy.setFirstVisibleRow(0);
+        proxy.setLastVisibleRow(9);
+        proxy.setMaximumResidentRows(20);
+        QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+        QTRY_VERIFY(source.isReleased(99));
+        QVERIFY(!source.isReleased(19));
+        QVERIFY(source.isReleased(20));
+        QVERIFY(!isPlaceholder(proxy, 5));
+        QVERIFY(isPlaceholder(proxy, 50));
+        QVERIFY(!proxy.index(50, 0).data().isValid());
+
+        // Rows around the new position are asked back, the old ones dropped.
+        proxy.setFirstVisibleRow(50);
+        proxy.setLastVisibleRow(59);
+        QTRY_VERIFY(source.isReleased(0));
+        QVERIFY(!source.isReleased(45));
+        QVERIFY(!isPlaceholder(proxy, 50));
+        QCOMPARE(proxy.index(50, 0).data().toInt(), 50);
+
+        // Without a limit everything comes back.
+        proxy.setMaximumResidentRows(0);
+        QVERIFY(!source.isReleased(0));
+        QVERIFY(!isPlaceholder(proxy, 0));
+    }
+
+    void testNoReleaseWithoutProtocol()
+    {
+        PagedModel source(100, 100);
+        TablePagingProxyModel proxy;
+        proxy.setSourceModel(&source);
+        proxy.setLastVisibleRow(9);
+        proxy.setMaximumResidentRows(20);
+        QTest::qWait(10);
+        QVERIFY(!isPlaceholder(proxy, 99));
+        QCOMPARE(proxy.index(99, 0).data().toInt(), 99);
+    }
+};
+
+QTEST_GUILESS_MAIN(TablePagingProxyModelTest)
+
+#include "tablepagingproxymodeltest.moc"
@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "tableselectionhelper.h"
+
+#include <QStandardItemModel>
+#include <QTest>
+
+#include <algorithm>
+
+namespace
+{
+// The selected cells as "row,column", sorted, so failures are readable.
+QStringList selectedCells(const QItemSelectionModel &selectionModel)
+{
+    QModelIndexList indexes = selectionModel.selectedIndexes();
+    std::sort(indexes.begin(), indexes.end());
+    QStringList cells;
+    for (const QModelIndex &index : std::as_const(indexes)) {
+        cells.append(QStringLiteral("%1,%2").arg(index.row()).arg(index.column()));
+    }
+    return cells;
+}
+
+QStringList block(int firstRow, int firstColumn, int lastRow, int lastColumn)
+{
+    QStringList cells;
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            cells.append(QStringLiteral("%1,%2").arg(row).arg(column));
+        }
+    }
+    return cells;
+}
+}
+
+class TableSelectionHelperTest : public QObject
+{
+    Q_OBJECT
+
+    QStandardItemModel m_model{5, 3};
+    QItemSelectionModel m_selectionModel{&m_model};
+    TableSelectionHelper m_helper;
+
+private Q_SLOTS:
+    void init()
+    {
+        m_selectionModel.clear();
+        m_helper.setSelectionModel(nullptr);
+        m_helper.setSelectionModel(&m_selectionModel);
+        m_helper.setSelectionBehavior(TableSelectionHelper::SelectCells);
+        m_helper.setSelectionMode(TableSelectionHelper::ExtendedSelection);
+    }
+
+    void testClick()
+    {
+        m_helper.selectCell(1, 2);
+        QCOMPARE(selectedCells(m_selectionModel), block(1, 2, 1, 2));
+        QCOMPARE(m_selectionModel.currentIndex(), m_model.index(1, 2));
+
+        m_helper.selectCell(3, 0);
+        QCOMPARE(selectedCells(m_selectionModel), block(3, 0, 3, 0));
+    }
+
+    void testClickSelectsRowsAndColumns()
+    {
+        m_helper.setSelectionBehavior(TableSelectionHelper::SelectRows);
+        m_helper.selectCell(2, 1);
+        QCOMPARE(selectedCells(m_selectionModel), block(2, 0, 2, 2));
+
+        m_helper.setSelectionBehavior(TableSelectionHelper::SelectColumns);
+        m_helper.selectCell(2, 1);
+        QCOMPARE(selectedCells(m_selectionModel), block(0, 1, 4, 1));
+    }
+
+    void testSelectionDisabled()
+    {
+        m_helper.setSelectionBehavior(TableSelectionHelper::SelectionDisabled);
+        m_helper.selectCell(1, 1);
+        QVERIFY(!m_selectionModel.hasSelection());
+        QVERIFY(!m_helper.moveCurrent(1, 0));
+    }
+
+    void testCtrlToggles()
+    {
+        m_helper.selectCell(0, 0);
+        m_helper.selectCell(2, 2, Qt::ControlModifier);
+        QCOMPARE(selectedCells(m_selectionModel), QStringList({QStringLiteral("0,0"), QStringLiteral("2,2")}));
+
+        m_helper.selectCell(0, 0, Qt::ControlModifier);
+        QCOMPARE(selectedCells(m_selectionModel), block(2, 2, 2, 2));
+
+        // Toggling the last cell off also drops the current index.
+        m_helper.selectCell(2, 2, Qt::ControlModifier);
+        QVERIFY(!m_selectionModel.hasSelection());
+        QVERIFY(!m_selectionModel.currentIndex().isValid());
+    }
+
+    void testShiftClickSelectsRangeFromAnchor()
+    {
+        m_helper.selectCell(1, 0);
+        m_helper.selectCell(3, 2, Qt::ShiftModifier);
+        QCOMPARE(selectedCells(m_selectionModel), block(1, 0, 3, 2));
+        QCOMPARE(m_selectionModel.currentIndex(), m_model.index(3, 2));
+        // A single range however many cells it spans.
+        QCOMPARE(m_selectionModel.selection().size(), 1);
+
+        // The anchor stays where the plain click was, the range flips around it.
+        m_helper.selectCell(0, 0, Qt::ShiftModifier);
+        QCOMPARE(selectedCells(m_selectionModel), block(0, 0, 1, 0));
+    }
+
+    void testShiftClickReplacesSelection()
+    {
+        m_helper.selectCell(0, 0);
+        m_helper.selectCell(2, 2, Qt::ControlModifier);
+        m_helper.selectCell(3, 1, Qt::ShiftModifier);
+        QCOMPARE(selectedCells(m_selectionModel), block(2, 1, 3, 2));
+    }
+
+    void testCtrlShiftClickAddsRange()
+    {
+        m_helper.selectCell(0, 0);
+        m_helper.selectCell(2, 2, Qt::ControlModifier);
+        m_helper.selectCell(3, 1, Qt::ControlModifier | Qt::ShiftModifier);
+        QCOMPARE(selectedCells(m_selectionModel), QStringList{QStringLiteral("0,0")} + block(2, 1, 3, 2));
+    }
+
+    void testShiftClickWithoutAnchor()
+    {
+        m_helper.selectCell(2, 1, Qt::ShiftModifier);
+        QCOMPARE(selectedCells(m_selectionModel), block(2, 1, 2, 1));
+
+        // The first click became the anchor.
+        m_helper.selectCell(3, 2, Qt::ShiftModifier);
+        QCOMPARE(selectedCells(m_selectionModel), block(2, 1, 3, 2));
+    }
+
+    void testShiftRowRange()
+    {
+        m_helper.setSelectionBehavior(TableSelectionHelper::SelectRows);
+        m_helper.selectRow(1);
+        m_helper.selectRow(3, Qt::ShiftModifier);
+        QCOMPARE(selectedCells(m_selectionModel), block(1, 0, 3, 2));
+        QCOMPARE(m_selectionModel.selectedRows().size(), 3);
+    }
+
+    void testShiftColumnRange()
+    {
+        m_helper.setSelectionBehavior(TableSelectionHelper::SelectColumns);
+        m_helper.selectColumn(2);
+        m_helper.selectColumn(1, Qt::ShiftModifier);
+        QCOMPARE(selectedCells(m_selectionModel), block(0, 1, 4, 2));
+    }
+
+    void testSingleSelectionIgnoresModifiers()
+    {
+        m_helper.setSelectionMode(TableSelectionHelper::SingleSelection);
+        m_helper.selectCell(0, 0);
+        m_helper.selectCell(2, 2, Qt::ShiftModifier);
+        QCOMPARE(selectedCells(m_selectionModel), block(2, 2, 2, 2));
+
+        m_helper.selectCell(1, 1, Qt::ControlModifier);
+        QCOMPARE(selectedCells(m_selectionModel), block(1, 1, 1, 1));
+
+        m_helper.selectAll();
+        QCOMPARE(selectedCells(m_selectionModel), block(1, 1, 1, 1));
+    }
+
+    void testMoveCurrent()
+    {
+        QVERIFY(m_helper.moveCurrent(1, 0));
+        // Nothing was current, so the first cell is.
+        QCOMPARE(selectedCells(m_selectionModel), block(0, 0, 0, 0));
+
+        QVERIFY(m_helper.moveCurrent(1, 1));
+        QCOMPARE(selectedCells(m_selectionModel), block(1, 1, 1, 1));
+
+        // Clamped at the edges.
+        QVERIFY(m_helper.moveCurrent(0, 5));
+        QCOMPARE(m_selectionModel.currentIndex(), m_model.index(1, 2));
+        QVERIFY(!m_helper.moveCurrent(0, 1));
+    }
+
+    void testShiftArrowsExtendAndShrink()
+    {
+        m_helper.setSelectionBehavior(TableSelectionHelper::SelectRows);
+        m_helper.selectRow(1);
+        QVERIFY(m_helper.moveCurrent(1, 0, Qt::ShiftModifier));
+        QVERIFY(m_helper.moveCurrent(1, 0, Qt::ShiftModifier));
+        QCOMPARE(selectedCells(m_selectionModel), block(1, 0, 3, 2));
+
+        QVERIFY(m_helper.moveCurrent(-1, 0, Qt::ShiftModifier));
+        QCOMPARE(selectedCells(m_selectionModel), block(1, 0, 2, 2));
+        QCOMPARE(m_selectionModel.currentIndex().row(), 2);
+    }
+
+    void testCtrlArrowsMoveCurrentOnly()
+    {
+        m_helper.selectCell(1, 1);
+        QVERIFY(m_helper.moveCurrent(1, 0, Qt::ControlModifier));
+        QCOMPARE(m_selectionModel.currentIndex(), m_model.index(2, 1));
+        QCOMPARE(selectedCells(m_selectionModel), block(1, 1, 1, 1));
+    }
+
+    void testSelectAll()
+    {
+        m_helper.selectCell(1, 1);
+        m_helper.selectAll();
+        QCOMPARE(selectedCells(m_selectionModel), block(0, 0, 4, 2));
+        QCOMPARE(m_selectionModel.selection().size(), 1);
+    }
+};
+
+QTEST_GUILESS_MAIN(TableSelectionHelperTest)
+
+#include "tableselectionhelpertest.moc"
@@ -0,0 +1,334 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "tablesortproxymodel.h"
+
+#include <QAbstractItemModelTester>
+#include <QDateTime>
+#include <QSignalSpy>
+#include <QSortFilterProxyModel>
+#include <QStandardItemModel>
+#include <QTest>
+#include <QTimeZone>
+
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+constexpr int KeyRole = Qt::UserRole;
+constexpr int SecondaryRole = Qt::UserRole + 1;
+
+QStandardItem *item(const QVariant &key, const QVariant &secondary = {})
+{
+    auto item = new QStandardItem;
+    item->setData(key, KeyRole);
+    item->setData(secondary, SecondaryRole);
+    return item;
+}
+
+void fill(QStandardItemModel &model, const QVariantList &keys)
+{
+    model.clear();
+    for (const QVariant &key : keys) {
+        model.appendRow(item(key));
+    }
+}
+
+// The source rows in the order TableSortProxyModel shows them.
+QList<int> order(const TableSortProxyModel &proxy)
+{
+    QList<int> rows;
+    for (int row = 0; row < proxy.rowCount(); ++row) {
+        rows.append(proxy.mapRowToSource(row));
+    }
+    return rows;
+}
+
+// The source rows in the order a freshly sorted QSortFilterProxyModel, which
+// is stable as well, shows them.
+QList<int> expectedOrder(QAbstractItemModel &model, Qt::SortOrder sortOrder)
+{
+    QSortFilterProxyModel reference;
+    reference.setSortCaseSensitivity(Qt::CaseInsensitive);
+    reference.setSortRole(KeyRole);
+    reference.setSourceModel(&model);
+    reference.sort(0, sortOrder);
+
+    QList<int> rows;
+    for (int row = 0; row < reference.rowCount(); ++row) {
+        rows.append(reference.mapToSource(reference.index(row, 0)).row());
+    }
+    return rows;
+}
+
+QVariantList integers(int count, int modulo)
+{
+    QVariantList keys;
+    for (int i = 0; i < count; ++i) {
+        keys.append((i * 7919) % modulo);
+    }
+    return keys;
+}
+}
+
+class TableSortProxyModelTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testMatchesQSortFilterProxyModel_data()
+    {
+        QTest::addColumn<QVariantList>("keys");
+        QTest::addColumn<Qt::SortOrder>("sortOrder");
+
+        const QVariantList integerKeys{3, 1, 2, 1, 3, 0, 2, 1};
+        QTest::newRow("integers") << integerKeys << Qt::AscendingOrder;
+        QTest::newRow("integers descending") << integerKeys << Qt::DescendingOrder;
+        QTest::newRow("large integers") << QVariantList{qint64(1) << 40, -5, qint64(1) << 33, 0, -5} << Qt::AscendingOrder;
+        QTest::newRow("reals") << QVariantList{2.5, -1.0, 2.5, 0.0, 10.25, -1.0} << Qt::AscendingOrder;
+        QTest::newRow("reals descending") << QVariantList{2.5, -1.0, 2.5, 0.0, 10.25, -1.0} << Qt::DescendingOrder;
+        QTest::newRow("dates") << QVariantList{QDate(2024, 5, 1), QDate(1999, 12, 31), QDate(2024, 5, 1), QDate(2024, 4, 30)}
+                               << Qt::AscendingOrder;
+        QTest::newRow("date times") << QVariantList{QDateTime(QDate(2024, 1, 1), QTime(12, 0), QTimeZone::UTC),
+                                                    QDateTime(QDate(2024, 1, 1), QTime(8, 30), QTimeZone::UTC),
+                                                    QDateTime(QDate(2023, 6, 1), QTime(23, 59), QTimeZone::UTC)}
+                                    << Qt::DescendingOrder;
+        QTest::newRow("strings") << QVariantList{QStringLiteral("pear"),
+                                                 QStringLiteral("Apple"),
+                                                 QStringLiteral("fig"),
+                                                 QStringLiteral("apple"),
+                                                 QStringLiteral("banana")}
+                                 << Qt::AscendingOrder;
+    }
+
+    void testMatchesQSortFilterProxyModel()
+    {
+        QFETCH(QVariantList, keys);
+        QFETCH(Qt::SortOrder, sortOrder);
+
+        QStandardItemModel source;
+        fill(source, keys);
+        TableSortProxyModel proxy;
+        proxy.setSortRole(KeyRole);
+        proxy.setSortOrder(sortOrder);
+        proxy.setSourceModel(&source);
+
+        QCOMPARE(order(proxy), expectedOrder(source, sortOrder));
+    }
+
+    void testParallelSort_data()
+    {
+        QTest::addColumn<Qt::SortOrder>("sortOrder");
+        QTest::newRow("ascending") << Qt::AscendingOrder;
+        QTest::newRow("descending") << Qt::DescendingOrder;
+    }
+
+    void testParallelSort()
+    {
+        QFETCH(Qt::SortOrder, sortOrder);
+
+        // Lots of ties, so that the merges have to keep the source order.
+        QStandardItemModel source;
+        fill(source, integers(5000, 97));
+        TableSortProxyModel proxy;
+        proxy.setParallelSortThreshold(2);
+        proxy.setSortRole(KeyRole);
+        proxy.setSortOrder(sortOrder);
+        proxy.setSourceModel(&source);
+
+        QCOMPARE(order(proxy), expectedOrder(source, sortOrder));
+    }
+
+    void testSortRoleChange()
+    {
+        QStandardItemModel source;
+        fill(source, integers(50, 7));
+        TableSortProxyModel proxy;
+        proxy.setSourceModel(&source);
+        QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+        QList<int> identity(50);
+        std::iota(identity.begin(), identity.end(), 0);
+        QCOMPARE(order(proxy), identity);
+
+        QSignalSpy layoutSpy(&proxy, &QAbstractItemModel::layoutChanged);
+        const QPersistentModelIndex persistent = proxy.index(10, 0);
+        proxy.setSortRole(KeyRole);
+        QCOMPARE(layoutSpy.size(), 1);
+        QCOMPARE(order(proxy), expectedOrder(source, Qt::AscendingOrder));
+        QCOMPARE(proxy.mapToSource(persistent).row(), 10);
+
+        proxy.setSortRole(-1);
+        QCOMPARE(order(proxy), identity);
+    }
+
+    void testSecondarySortKeys()
+    {
+        QStandardItemModel source;
+        const QList<std::pair<int, int>> keys{{2, 1}, {1, 5}, {2, 3}, {1, 2}, {2, 3}};
+        for (const auto &[primary, secondary] : keys) {
+            source.appendRow(item(primary, secondary));
+        }
+
+        TableSortProxyModel proxy;
+        proxy.setSortRole(KeyRole);
+        proxy.setSecondarySortKeys({QVariantMap{{QStringLiteral("role"), SecondaryRole}, {QStringLiteral("order"), int(Qt::DescendingOrder)}}});
+        proxy.setSourceModel(&source);
+
+        QList<int> expected(keys.size());
+        std::iota(expected.begin(), expected.end(), 0);
+        std::stable_sort(expected.begin(), expected.end(), [&keys](int left, int right) {
+            if (keys[left].first != keys[right].first) {
+                return keys[left].first < keys[right].first;
+            }
+            return keys[left].second > keys[right].second;
+        });
+        QCOMPARE(order(proxy), expected);
+    }
+
+    void testEmptyValuesFirst()
+    {
+        QStandardItemModel source;
+        fill(source, {3, QVariant(), 1, QVariant()});
+        TableSortProxyModel proxy;
+        proxy.setSortRole(KeyRole);
+        proxy.setSourceModel(&source);
+        QCOMPARE(order(proxy), QList<int>({1, 3, 2, 0}));
+    }
+
+    void testDataChangeMovesRow()
+    {
+        QStandardItemModel source;
+        fill(source, integers(40, 5));
+        TableSortProxyModel proxy;
+        proxy.setSortRole(KeyRole);
+        proxy.setSourceModel(&source);
+        QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+        QSignalSpy movedSpy(&proxy, &QAbstractItemModel::rowsMoved);
+        QSignalSpy layoutSpy(&proxy, &QAbstractItemModel::layoutChanged);
+        QSignalSpy resetSpy(&proxy, &QAbstractItemModel::modelReset);
+
+        const QPersistentModelIndex moved = proxy.index(proxy.mapRowFromSource(7), 0);
+        source.item(7)->setData(-1, KeyRole);
+        QCOMPARE(movedSpy.size(), 1);
+        QCOMPARE(proxy.mapRowFromSource(7), 0);
+        QCOMPARE(moved.row(), 0);
+        QCOMPARE(order(proxy), expectedOrder(source, Qt::AscendingOrder));
+
+        source.item(7)->setData(100, KeyRole);
+        source.item(12)->setData(2, KeyRole);
+        QCOMPARE(order(proxy), expectedOrder(source, Qt::AscendingOrder));
+
+        // Still in place, nothing moves.
+        movedSpy.clear();
+        source.item(7)->setData(99, KeyRole);
+        QCOMPARE(movedSpy.size(), 0);
+
+        QCOMPARE(layoutSpy.size(), 0);
+        QCOMPARE(resetSpy.size(), 0);
+    }
+
+    void testOtherRoleChangeKeepsOrder()
+    {
+        QStandardItemModel source;
+        fill(source, integers(20, 3));
+        TableSortProxyModel proxy;
+        proxy.setSortRole(KeyRole);
+        proxy.setSourceModel(&source);
+
+        const QList<int> before = order(proxy);
+        QSignalSpy movedSpy(&proxy, &QAbstractItemModel::rowsMoved);
+        QSignalSpy dataSpy(&proxy, &QAbstractItemModel::dataChanged);
+        source.item(4)->setData(QStringLiteral("changed"), Qt::DisplayRole);
+        QCOMPARE(dataSpy.size(), 1);
+        QCOMPARE(dataSpy.at(0).at(0).toModelIndex(), proxy.index(proxy.mapRowFromSource(4), 0));
+        QCOMPARE(movedSpy.size(), 0);
+        QCOMPARE(order(proxy), before);
+    }
+
+    void testInsertRows()
+    {
+        QStandardItemModel source;
+        fill(source, integers(30, 4));
+        TableSortProxyModel proxy;
+        proxy.setSortRole(KeyRole);
+        proxy.setSourceModel(&source);
+        QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+        QSignalSpy insertedSpy(&proxy, &QAbstractItemModel::rowsInserted);
+        QSignalSpy layoutSpy(&proxy, &QAbstractItemModel::layoutChanged);
+
+        source.insertRow(0, item(2));
+        source.insertRow(10, item(-1));
+        source.appendRow(item(1));
+        QCOMPARE(insertedSpy.size(), 3);
+        QCOMPARE(layoutSpy.size(), 0);
+        QCOMPARE(proxy.mapRowToSource(0), 10);
+        QCOMPARE(order(proxy), expectedOrder(source, Qt::AscendingOrder));
+
+        // A large batch is appended then sorted in with a single layout change.
+        QList<QStandardItem *> batch;
+        const QVariantList keys = integers(200, 11);
+        for (const QVariant &key : keys) {
+            batch.append(item(key));
+        }
+        source.invisibleRootItem()->insertRows(5, batch);
+        QCOMPARE(layoutSpy.size(), 1);
+        QCOMPARE(proxy.rowCount(), source.rowCount());
+        QCOMPARE(order(proxy), expectedOrder(source, Qt::AscendingOrder));
+    }
+
+    void testInsertRowsUnsorted()
+    {
+        QStandardItemModel source;
+        fill(source, integers(10, 4));
+        TableSortProxyModel proxy;
+        proxy.setSourceModel(&source);
+        QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+        source.insertRow(3, item(0));
+        QList<int> identity(11);
+        std::iota(identity.begin(), identity.end(), 0);
+        QCOMPARE(order(proxy), identity);
+    }
+
+    void testRemoveRows()
+    {
+        QStandardItemModel source;
+        fill(source, integers(30, 4));
+        TableSortProxyModel proxy;
+        proxy.setSortRole(KeyRole);
+        proxy.setSourceModel(&source);
+        QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+        source.removeRows(3, 5);
+        QCOMPARE(proxy.rowCount(), 25);
+        QCOMPARE(order(proxy), expectedOrder(source, Qt::AscendingOrder));
+
+        source.removeRows(0, 1);
+        source.removeRows(23, 1);
+        QCOMPARE(order(proxy), expectedOrder(source, Qt::AscendingOrder));
+        for (int row = 0; row < source.rowCount(); ++row) {
+            QCOMPARE(proxy.mapRowToSource(proxy.mapRowFromSource(row)), row);
+        }
+    }
+
+    void testSourceReset()
+    {
+        QStandardItemModel source;
+        fill(source, integers(30, 4));
+        TableSortProxyModel proxy;
+        proxy.setSortRole(KeyRole);
+        proxy.setSourceModel(&source);
+        QAbstractItemModelTester tester(&proxy, QAbstractItemModelTester::FailureReportingMode::QtTest);
+
+        fill(source, integers(12, 5));
+        QCOMPARE(order(proxy), expectedOrder(source, Qt::AscendingOrder));
+    }
+};
+
+QTEST_GUILESS_MAIN(TableSortProxyModelTest)
+
+#include "tablesortproxymodeltest.moc"
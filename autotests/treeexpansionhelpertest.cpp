@@ -0,0 +1,272 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "treeexpansionhelper.h"
+
+#include <QAbstractListModel>
+#include <QSignalSpy>
+#include <QTest>
+
+#include <vector>
+
+// A complete tree shown the way KDescendantsProxyModel does, with the same API.
+class DescendantsModel : public QAbstractListModel
+{
+    Q_OBJECT
+    Q_PROPERTY(bool expandsByDefault READ expandsByDefault WRITE setExpandsByDefault)
+
+public:
+    enum Roles {
+        LevelRole = Qt::UserRole + 1,
+        ExpandableRole,
+        ExpandedRole,
+    };
+
+    // fanout children per node, levels deep.
+    DescendantsModel(int fanout, int levels)
+    {
+        for (int i = 0; i < fanout; ++i) {
+            addNode(1, fanout, levels);
+        }
+        m_expanded.resize(m_nodes.size(), false);
+        rebuild();
+    }
+
+    int rowCount(const QModelIndex &parent = {}) const override
+    {
+        return parent.isValid() ? 0 : m_rows.size();
+    }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        const int node = m_rows.at(index.row());
+        switch (role) {
+        case LevelRole:
+            return m_nodes[node].level;
+        case ExpandableRole:
+            return !m_nodes[node].children.empty();
+        case ExpandedRole:
+            return bool(m_expanded[node]);
+        }
+        return {};
+    }
+
+    QHash<int, QByteArray> roleNames() const override
+    {
+        return {
+            {LevelRole, "kDescendantLevel"},
+            {ExpandableRole, "kDescendantExpandable"},
+            {ExpandedRole, "kDescendantExpanded"},
+        };
+    }
+
+    bool expandsByDefault() const
+    {
+        return m_expandsByDefault;
+    }
+
+    void setExpandsByDefault(bool expandsByDefault)
+    {
+        if (m_expandsByDefault == expandsByDefault) {
+            return;
+        }
+        beginResetModel();
+        m_expandsByDefault = expandsByDefault;
+        std::fill(m_expanded.begin(), m_expanded.end(), expandsByDefault);
+        rebuild();
+        endResetModel();
+    }
+
+    Q_INVOKABLE void expandChildren(int row)
+    {
+        const int node = m_rows.at(row);
+        if (m_nodes[node].children.empty() || m_expanded[node]) {
+            return;
+        }
+        m_expanded[node] = true;
+        QList<int> rows;
+        appendVisible(node, rows);
+        beginInsertRows({}, row + 1, row + rows.size());
+        for (int i = 0; i < rows.size(); ++i) {
+            m_rows.insert(row + 1 + i, rows.at(i));
+        }
+        endInsertRows();
+    }
+
+    Q_INVOKABLE void collapseChildren(int row)
+    {
+        const int node = m_rows.at(row);
+        if (!m_expanded[node]) {
+            return;
+        }
+        m_expanded[node] = false;
+        int last = row;
+        while (last + 1 < m_rows.size() && m_nodes[m_rows.at(last + 1)].level > m_nodes[node].level) {
+            ++last;
+        }
+        if (last > row) {
+            beginRemoveRows({}, row + 1, last);
+            m_rows.remove(row + 1, last - row);
+            endRemoveRows();
+        }
+    }
+
+    int levelAt(int row) const
+    {
+        return m_nodes[m_rows.at(row)].level;
+    }
+
+private:
+    struct Node {
+        int level;
+        std::vector<int> children;
+    };
+
+    int addNode(int level, int fanout, int levels)
+    {
+        const int node = int(m_nodes.size());
+        m_nodes.push_back({level, {}});
+        if (level < levels) {
+            for (int i = 0; i < fanout; ++i) {
+                const int child = addNode(level + 1, fanout, levels);
+                m_nodes[node].children.push_back(child);
+            }
+        }
+        return node;
+    }
+
+    void appendVisible(int node, QList<int> &rows) const
+    {
+        if (!m_expanded[node]) {
+            return;
+        }
+        for (int child : m_nodes[node].children) {
+            rows.append(child);
+            appendVisible(child, rows);
+        }
+    }
+
+    void rebuild()
+    {
+        m_rows.clear();
+        for (int node = 0; node < int(m_nodes.size()); ++node) {
+            if (m_nodes[node].level == 1) {
+                m_rows.append(node);
+                appendVisible(node, m_rows);
+            }
+        }
+    }
+
+    std::vector<Node> m_nodes;
+    std::vector<bool> m_expanded;
+    QList<int> m_rows;
+    bool m_expandsByDefault = false;
+};
+
+class TreeExpansionHelperTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testExpandAndCollapseAll()
+    {
+        DescendantsModel model(3, 3);
+        TreeExpansionHelper helper;
+        helper.setModel(&model);
+        QSignalSpy finishedSpy(&helper, &TreeExpansionHelper::finished);
+
+        helper.expandAll();
+        QCOMPARE(model.rowCount(), 3 + 9 + 27);
+        helper.collapseAll();
+        QCOMPARE(model.rowCount(), 3);
+        QCOMPARE(finishedSpy.size(), 2);
+    }
+
+    void testExpandToDepth()
+    {
+        DescendantsModel model(3, 3);
+        TreeExpansionHelper helper;
+        helper.setModel(&model);
+        QSignalSpy finishedSpy(&helper, &TreeExpansionHelper::finished);
+        QSignalSpy canceledSpy(&helper, &TreeExpansionHelper::canceled);
+
+        helper.expandToDepth(1);
+        QTRY_COMPARE(finishedSpy.size(), 1);
+        QCOMPARE(canceledSpy.size(), 0);
+        QCOMPARE(model.rowCount(), 3 + 9);
+        for (int row = 0; row < model.rowCount(); ++row) {
+            QVERIFY(model.levelAt(row) <= 2);
+        }
+    }
+
+    void testSubtreeInBatches()
+    {
+        DescendantsModel model(3, 3);
+        TreeExpansionHelper helper;
+        helper.setBatchSize(2);
+        helper.setModel(&model);
+        QSignalSpy finishedSpy(&helper, &TreeExpansionHelper::finished);
+        QSignalSpy canceledSpy(&helper, &TreeExpansionHelper::canceled);
+
+        helper.expandSubtree(0);
+        QVERIFY(helper.isBusy());
+        QTRY_VERIFY(!helper.isBusy());
+        QCOMPARE(finishedSpy.size(), 1);
+        QCOMPARE(helper.progress(), 1.0);
+        QCOMPARE(model.rowCount(), 3 + 3 + 9);
+        QCOMPARE(model.levelAt(model.rowCount() - 2), 1);
+
+        helper.collapseSubtree(0);
+        QTRY_VERIFY(!helper.isBusy());
+        QCOMPARE(finishedSpy.size(), 2);
+        QCOMPARE(model.rowCount(), 3);
+        QCOMPARE(canceledSpy.size(), 0);
+
+        // The children were collapsed as well.
+        model.expandChildren(0);
+        QCOMPARE(model.rowCount(), 3 + 3);
+    }
+
+    void testCanceledByOutsideChange()
+    {
+        DescendantsModel model(3, 3);
+        TreeExpansionHelper helper;
+        helper.setBatchSize(1);
+        helper.setModel(&model);
+        QSignalSpy canceledSpy(&helper, &TreeExpansionHelper::canceled);
+
+        helper.expandSubtree(0);
+        QVERIFY(helper.isBusy());
+
+        // Rows the helper did not ask for shift the ones it is walking through.
+        model.expandChildren(model.rowCount() - 1);
+        QCOMPARE(canceledSpy.size(), 1);
+        QVERIFY(!helper.isBusy());
+
+        helper.expandSubtree(0);
+        QVERIFY(helper.isBusy());
+        model.setExpandsByDefault(true);
+        QCOMPARE(canceledSpy.size(), 2);
+    }
+
+    void testCancel()
+    {
+        DescendantsModel model(3, 3);
+        TreeExpansionHelper helper;
+        helper.setBatchSize(1);
+        helper.setModel(&model);
+        QSignalSpy canceledSpy(&helper, &TreeExpansionHelper::canceled);
+        QSignalSpy finishedSpy(&helper, &TreeExpansionHelper::finished);
+
+        helper.expandSubtree(0);
+        helper.cancel();
+        QVERIFY(!helper.isBusy());
+        QCOMPARE(canceledSpy.size(), 1);
+        QTest::qWait(10);
+        QCOMPARE(finishedSpy.size(), 0);
+    }
+};
+
+QTEST_GUILESS_MAIN(TreeExpansionHelperTest)
+
+#include "treeexpansionhelpertest.moc"
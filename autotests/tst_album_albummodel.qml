@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-GPL
+
+import QtQuick 2.15
+import QtTest 1.2
+
+import org.kde.lingmouiaddons.labs.components 1.0
+
+TestCase {
+    id: root
+    name: "AlbumModelTest"
+
+    readonly property string testImage: dataDir + "/kmail.png"
+    readonly property string testVideo: dataDir + "/discover_hl_720p.webm"
+
+    Component {
+        id: albumModel
+        AlbumModel {}
+    }
+
+    function test_folder() {
+        const model = createTemporaryObject(albumModel, root, { folder: Qt.resolvedUrl("file://" + dataDir) });
+        tryCompare(model, "loading", false);
+        compare(model.count, 2);
+
+        // Sorted by name.
+        compare(model.data(model.index(0, 0), AlbumModel.SourceRole), Qt.resolvedUrl("file://" + root.testVideo));
+        compare(model.data(model.index(0, 0), AlbumModel.TypeRole), AlbumModel.Video);
+        compare(model.data(model.index(1, 0), AlbumModel.TypeRole), AlbumModel.Image);
+        compare(model.data(model.index(1, 0), AlbumModel.CaptionRole), "kmail.png");
+    }
+
+    function test_sources() {
+        const model = createTemporaryObject(albumModel, root, {
+            sources: [Qt.resolvedUrl("file://" + root.testImage), Qt.resolvedUrl("file://" + root.testVideo)]
+        });
+        tryCompare(model, "loading", false);
+        compare(model.count, 2);
+
+        // Dimensions come from the PNG header.
+        compare(model.data(model.index(0, 0), AlbumModel.SourceWidthRole), 1295);
+        compare(model.data(model.index(0, 0), AlbumModel.SourceHeightRole), 1083);
+        compare(model.data(model.index(1, 0), AlbumModel.SourceWidthRole), 0);
+    }
+}
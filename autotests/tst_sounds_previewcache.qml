@@ -0,0 +1,62 @@
+/*
+ * SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick
+import QtTest
+import org.kde.lingmouiaddons.sounds
+import QtMultimedia
+
+SoundsPicker {
+    id: soundsPicker
+    theme: 'freedesktop'
+    previewCacheEnabled: true
+    width: 50
+    height: 50
+
+    TestCase {
+        name: "SoundsPreviewCacheTest"
+        when: windowShown
+
+        function test_prefetch() {
+            // The visible rows get decoded once the view settles.
+            tryVerify(() => soundsPicker.previewCache.entryCount > 0, 10000);
+            verify(soundsPicker.previewCache.contains(soundsPicker.model.initialSourceUrl(0)));
+            verify(soundsPicker.previewCache.cacheSize > 0);
+        }
+
+        function test_click() {
+            tryVerify(() => soundsPicker.previewCache.contains(soundsPicker.model.initialSourceUrl(0)), 10000);
+            const hits = soundsPicker.previewCache.hitCount;
+
+            mouseClick(soundsPicker, 5, 5);
+            compare(soundsPicker.previewCache.playing, true);
+            compare(soundsPicker.previewCache.hitCount, hits + 1);
+            // Cached previews do not go through the media player.
+            compare(soundsPicker.audioPlayer.playbackState, MediaPlayer.StoppedState);
+
+            mouseClick(soundsPicker, 5, 5);
+            compare(soundsPicker.previewCache.playing, false);
+            compare(soundsPicker.audioPlayer.playbackState, MediaPlayer.StoppedState);
+        }
+
+        function test_eviction() {
+            tryVerify(() => soundsPicker.previewCache.entryCount > 0, 10000);
+            const evictions = soundsPicker.previewCache.evictionCount;
+            const maximumCacheSize = soundsPicker.previewCache.maximumCacheSize;
+
+            // Decoded previews are larger than one byte, nothing fits.
+            soundsPicker.previewCache.maximumCacheSize = 1;
+            compare(soundsPicker.previewCache.entryCount, 0);
+            compare(soundsPicker.previewCache.cacheSize, 0);
+            verify(soundsPicker.previewCache.evictionCount > evictions);
+
+            // Fill the cache again for the other tests.
+            soundsPicker.previewCache.maximumCacheSize = maximumCacheSize;
+            soundsPicker.previewCache.prefetch(0, soundsPicker.count - 1);
+            tryVerify(() => soundsPicker.previewCache.entryCount > 0, 10000);
+        }
+    }
+}
@@ -57,7 +57,7 @@ LingmoUI.Page {
                     view.selectionModel.select(selectedIndexes[i], ItemSelectionModel.Select);
                 }
 
-                view.selectionModel.setCurrentIndex(view.model.index(currentIndex, 0), ItemSelectionModel.Select);
+                view.selectionModel.setCurrentIndex(view.viewModel.index(currentIndex, 0), ItemSelectionModel.Select);
             }
 
             headerComponents: [
@@ -63,7 +63,7 @@ LingmoUI.Page {
                     view.selectionModel.select(selectedIndexes[i], ItemSelectionModel.Select);
                 }
 
-                view.selectionModel.setCurrentIndex(view.model.index(currentRow, currentColumn), ItemSelectionModel.Select);
+                view.selectionModel.setCurrentIndex(view.viewModel.index(currentRow, currentColumn), ItemSelectionModel.Select);
             }
 
             headerComponents: [
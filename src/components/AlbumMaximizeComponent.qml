@@ -114,6 +114,14 @@ AbstractMaximizeComponent {
      */
     property LingmoUI.Action pauseAction
 
+    /**
+     * @brief The number of images decoded ahead of time on each side of the current item.
+     *
+     * Decoded images are kept in AlbumImageCache, whose maximumSize bounds the
+     * memory used by all albums.
+     */
+    property alias prefetchCount: prefetcher.prefetchCount
+
     /**
      * @brief The current item in the view.
      */
@@ -273,6 +281,15 @@ AbstractMaximizeComponent {
             id: hoverHandler
             acceptedDevices: PointerDevice.Mouse
         }
+
+        AlbumPrefetcher {
+            id: prefetcher
+            enabled: root.visible
+            model: root.model
+            currentIndex: view.currentIndex
+            targetSize: Qt.size(view.width, view.height)
+            devicePixelRatio: Screen.devicePixelRatio
+        }
     }
 
     footer: QQC2.Control {
@@ -85,44 +85,60 @@ Item {
      */
     signal itemRightClicked()
 
+    /**
+     * @brief The loading status of the content image.
+     */
+    readonly property int status: __animated ? animatedImage.status : image.status
+
     /**
      * @brief Start media playback.
      */
     function play() {
-        image.paused = false
+        animatedImage.paused = false
     }
 
     /**
      * @brief Pause media playback.
      */
     function pause() {
-        image.paused = true
+        animatedImage.paused = true
     }
 
+    // Still local images are decoded at the displayed size and shared with
+    // AlbumPrefetcher through AlbumImageCache, anything else is loaded as is.
+    readonly property bool __animated: AlbumImageCache.isAnimated(root.source)
+    readonly property url __cachedSource: __animated ? "" : AlbumImageCache.cachedSource(root.source)
+    readonly property bool __cached: __cachedSource.toString() !== ""
+    readonly property size __naturalSize: __animated ? animatedImage.sourceSize
+                                        : __cached ? Qt.size(image.implicitWidth, image.implicitHeight)
+                                        : image.sourceSize
+
     clip: true
 
-    // AnimatedImage so we can handle GIFs.
-    AnimatedImage {
+    Image {
         id: image
 
         property var rotationInsensitiveWidth: {
             if (sourceWidth > 0) {
                 return Math.min(root.sourceWidth, root.width - root.padding * 2);
             } else {
-                return Math.min(sourceSize.width, root.width - root.padding * 2);
+                return Math.min(root.__naturalSize.width, root.width - root.padding * 2);
             }
         }
         property var rotationInsensitiveHeight: {
             if (sourceHeight > 0) {
                 return Math.min(root.sourceHeight, root.height - root.padding * 2)
             } else {
-                return Math.min(sourceSize.height, root.height - root.padding * 2)
+                return Math.min(root.__naturalSize.height, root.height - root.padding * 2)
             }
         }
 
         anchors.centerIn: parent
 
-        source: root.source
+        source: root.__animated ? "" : root.__cached ? root.__cachedSource : root.source
+        // Must match the targetSize of the AlbumPrefetcher in AlbumMaximizeComponent.
+        sourceSize: root.__cached ? Qt.size(root.width, root.height) : undefined
+        asynchronous: true
 
         width: root.rotationAngle % 180 === 0 ? rotationInsensitiveWidth : rotationInsensitiveHeight
         height: root.rotationAngle % 180 === 0 ? rotationInsensitiveHeight : rotationInsensitiveWidth
@@ -136,12 +152,30 @@ Item {
             NumberAnimation {duration: LingmoUI.Units.longDuration; easing.type: Easing.InOutCubic}
         }
 
+        // AnimatedImage so we can handle GIFs.
+        AnimatedImage {
+            id: animatedImage
+            anchors.fill: parent
+            visible: root.__animated
+            source: root.__animated ? root.source : ""
+            fillMode: Image.PreserveAspectFit
+        }
+
+        // Sharp details when zoomed into large images, drawn over the screen sized image.
+        TiledImageItem {
+            anchors.fill: parent
+            visible: root.__cached && root.scaleFactor > 1
+            source: visible ? root.source : ""
+            zoom: scaleTransform.xScale
+            viewport: root
+        }
+
         Image {
             id: tempImage
             anchors.centerIn: parent
-            visible: source && status === Image.Ready && image.status !== Image.Ready
-            width:  root.sourceWidth > 0 || image.sourceSize.width > 0 ? root.sourceWidth : tempImage.sourceSize.width
-            height: root.sourceHeight > 0 || image.sourceSize.height > 0 ? root.sourceHeight : tempImage.sourceSize.height
+            visible: source && status === Image.Ready && root.status !== Image.Ready
+            width:  root.sourceWidth > 0 || root.__naturalSize.width > 0 ? root.sourceWidth : tempImage.sourceSize.width
+            height: root.sourceHeight > 0 || root.__naturalSize.height > 0 ? root.sourceHeight : tempImage.sourceSize.height
             source: root.tempSource
         }
 
@@ -156,6 +190,7 @@ Item {
                 }
             },
             Scale {
+                id: scaleTransform
                 origin.x: image.width / 2
                 origin.y: image.height / 2
                 xScale: root.scaleFactor
@@ -178,7 +213,7 @@ Item {
     }
     QQC2.BusyIndicator {
         anchors.centerIn: parent
-        visible: image.status !== Image.Ready && tempImage.status !== Image.Ready
+        visible: root.status !== Image.Ready && tempImage.status !== Image.Ready
         running: visible
     }
     MouseArea {
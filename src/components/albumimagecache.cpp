@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "albumimagecache.h"
+
+#include <QImageReader>
+#include <QMimeDatabase>
+#include <QMutexLocker>
+
+AlbumImageCache::AlbumImageCache(QObject *parent)
+    : QObject(parent)
+{
+}
+
+AlbumImageCache *AlbumImageCache::instance()
+{
+    static AlbumImageCache cache;
+    return &cache;
+}
+
+QString AlbumImageCache::providerId()
+{
+    return QStringLiteral("lingmouialbum");
+}
+
+QString AlbumImageCache::cacheKey(const QUrl &source, const QSize &requestedSize)
+{
+    return source.toString() + QLatin1Char('@') + QString::number(requestedSize.width()) + QLatin1Char('x') + QString::number(requestedSize.height());
+}
+
+QImage AlbumImageCache::decode(const QUrl &source, const QSize &requestedSize, QSize *originalSize)
+{
+    QImageReader reader(source.toLocalFile());
+    const QSize size = reader.size();
+    if (originalSize) {
+        *originalSize = size;
+    }
+
+    if (size.isValid() && (requestedSize.width() > 0 || requestedSize.height() > 0)) {
+        // A zero dimension means "keep the aspect ratio", like for Image.sourceSize.
+        const QSize bound(requestedSize.width() > 0 ? requestedSize.width() : size.width(),
+                          requestedSize.height() > 0 ? requestedSize.height() : size.height());
+        const QSize scaled = size.scaled(bound, Qt::KeepAspectRatio);
+        if (scaled.width() < size.width()) {
+            // Most formats (JPEG in particular) decode straight at the reduced size.
+            reader.setScaledSize(scaled);
+        }
+    }
+
+    return reader.read();
+}
+
+qint64 AlbumImageCache::maximumSize() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_maximumSize;
+}
+
+void AlbumImageCache::setMaximumSize(qint64 maximumSize)
+{
+    bool evicted = false;
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_maximumSize == maximumSize) {
+            return;
+        }
+        m_maximumSize = maximumSize;
+        evicted = evict();
+    }
+    Q_EMIT maximumSizeChanged();
+    if (evicted) {
+        Q_EMIT sizeChanged();
+    }
+}
+
+qint64 AlbumImageCache::size() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_size;
+}
+
+int AlbumImageCache::count() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_entries.size();
+}
+
+bool AlbumImageCache::contains(const QString &key) const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_entries.contains(key);
+}
+
+bool AlbumImageCache::find(const QString &key, QImage *image, QSize *originalSize)
+{
+    QMutexLocker locker(&m_mutex);
+    const auto it = m_entries.constFind(key);
+    if (it == m_entries.cend()) {
+        return false;
+    }
+
+    *image = it->image;
+    if (originalSize) {
+        *originalSize = it->originalSize;
+    }
+    m_recentlyUsed.splice(m_recentlyUsed.begin(), m_recentlyUsed, it->recentlyUsedPosition);
+    return true;
+}
+
+void AlbumImageCache::insert(const QString &key, const QImage &image, const QSize &originalSize)
+{
+    if (image.isNull()) {
+        return;
+    }
+
+    {
+        QMutexLocker locker(&m_mutex);
+        const auto it = m_entries.constFind(key);
+        if (it != m_entries.cend()) {
+            m_size -= it->image.sizeInBytes();
+            m_recentlyUsed.erase(it->recentlyUsedPosition);
+        }
+        m_recentlyUsed.push_front(key);
+        m_entries.insert(key, {image, originalSize, m_recentlyUsed.begin()});
+        m_size += image.sizeInBytes();
+        evict();
+    }
+    Q_EMIT sizeChanged();
+}
+
+bool AlbumImageCache::evict()
+{
+    bool evicted = false;
+    // Always keep the most recent entry, even when it alone exceeds the budget.
+    while (m_size > m_maximumSize && m_recentlyUsed.size() > 1) {
+        m_size -= m_entries.take(m_recentlyUsed.back()).image.sizeInBytes();
+        m_recentlyUsed.pop_back();
+        evicted = true;
+    }
+    return evicted;
+}
+
+bool AlbumImageCache::isCacheable(const QUrl &source) const
+{
+    if (!source.isLocalFile() || isAnimated(source)) {
+        return false;
+    }
+
+    static const QList<QByteArray> supportedMimeTypes = QImageReader::supportedMimeTypes();
+    const QMimeType mimeType = QMimeDatabase().mimeTypeForFile(source.toLocalFile(), QMimeDatabase::MatchExtension);
+    return supportedMimeTypes.contains(mimeType.name().toLatin1());
+}
+
+bool AlbumImageCache::isAnimated(const QUrl &source) const
+{
+    // This is called from bindings on the GUI thread, so only the formats that can be animated are opened.
+    const QMimeType mimeType = QMimeDatabase().mimeTypeForFile(source.path(), QMimeDatabase::MatchExtension);
+    const bool mayBeAnimated = mimeType.inherits(QStringLiteral("image/gif")) || mimeType.inherits(QStringLiteral("image/webp"))
+        || mimeType.inherits(QStringLiteral("image/apng")) || mimeType.inherits(QStringLiteral("video/x-mng"));
+    if (!mayBeAnimated) {
+        return false;
+    }
+    if (!source.isLocalFile()) {
+        // AnimatedImage handles remote files itself.
+        return true;
+    }
+
+    const QString path = source.toLocalFile();
+    {
+        QMutexLocker locker(&m_mutex);
+        const auto it = m_animated.constFind(path);
+        if (it != m_animated.cend()) {
+            return *it;
+        }
+    }
+
+    // Most WebP files are stills, only more than one frame makes an animation.
+    // An unknown frame count (0) is treated as animated, AnimatedImage shows stills too.
+    QImageReader reader(path);
+    const bool animated = reader.supportsAnimation() && reader.imageCount() != 1;
+
+    QMutexLocker locker(&m_mutex);
+    m_animated.insert(path, animated);
+    return animated;
+}
+
+QUrl AlbumImageCache::cachedSource(const QUrl &source) const
+{
+    if (!isCacheable(source)) {
+        return {};
+    }
+    return QUrl(QStringLiteral("image://") + providerId() + QLatin1Char('/') + QString::fromLatin1(QUrl::toPercentEncoding(source.toString())));
+}
+
+QUrl AlbumImageCache::sourceFromId(const QString &id)
+{
+    return QUrl(QUrl::fromPercentEncoding(id.toUtf8()));
+}
+
+void AlbumImageCache::clear()
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_entries.clear();
+        m_recentlyUsed.clear();
+        m_animated.clear();
+        m_size = 0;
+    }
+    Q_EMIT sizeChanged();
+}
+
+#include "moc_albumimagecache.cpp"
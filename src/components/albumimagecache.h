@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QImage>
+#include <QMutex>
+#include <QObject>
+#include <QUrl>
+
+#include <list>
+
+/**
+ * @brief Process wide cache of album images decoded at the size they are shown at.
+ *
+ * Entries are keyed by source and requested size and evicted in least recently
+ * used order once maximumSize bytes are exceeded. The cache is filled by the
+ * "lingmouialbum" image provider and by AlbumPrefetcher, both from worker
+ * threads, so all the accessors are thread-safe.
+ */
+class AlbumImageCache : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(qint64 maximumSize READ maximumSize WRITE setMaximumSize NOTIFY maximumSizeChanged)
+    Q_PROPERTY(qint64 size READ size NOTIFY sizeChanged)
+    Q_PROPERTY(int count READ count NOTIFY sizeChanged)
+
+public:
+    static AlbumImageCache *instance();
+
+    /// The id of the image provider serving cached images.
+    static QString providerId();
+
+    static QString cacheKey(const QUrl &source, const QSize &requestedSize);
+
+    /// Decode @p source so that it fits in @p requestedSize, images are never scaled up.
+    /// This function is reentrant.
+    static QImage decode(const QUrl &source, const QSize &requestedSize, QSize *originalSize = nullptr);
+
+    /// Upper bound of decoded pixel data in bytes, default 256 MiB.
+    qint64 maximumSize() const;
+    void setMaximumSize(qint64 maximumSize);
+
+    qint64 size() const;
+    int count() const;
+
+    bool contains(const QString &key) const;
+    bool find(const QString &key, QImage *image, QSize *originalSize = nullptr);
+    void insert(const QString &key, const QImage &image, const QSize &originalSize);
+
+    /// Whether @p source is a local still image that can be served from the cache.
+    Q_INVOKABLE bool isCacheable(const QUrl &source) const;
+
+    /// Whether @p source is an animated image. Only files in a format that
+    /// supports animation are opened to find out, the result is remembered.
+    Q_INVOKABLE bool isAnimated(const QUrl &source) const;
+
+    /// The image provider url for @p source, or an empty url if it is not cacheable.
+    Q_INVOKABLE QUrl cachedSource(const QUrl &source) const;
+
+    /// The source url encoded in the id of a provider request.
+    static QUrl sourceFromId(const QString &id);
+
+    Q_INVOKABLE void clear();
+
+Q_SIGNALS:
+    void maximumSizeChanged();
+    void sizeChanged();
+
+private:
+    explicit AlbumImageCache(QObject *parent = nullptr);
+
+    struct Entry {
+        QImage image;
+        QSize originalSize;
+        std::list<QString>::iterator recentlyUsedPosition;
+    };
+
+    // Must be called with m_mutex locked, returns whether anything was evicted.
+    bool evict();
+
+    mutable QMutex m_mutex;
+    QHash<QString, Entry> m_entries;
+    std::list<QString> m_recentlyUsed; // most recent first, entries point at their position
+    qint64 m_size = 0;
+    qint64 m_maximumSize = 256 * 1024 * 1024;
+    mutable QHash<QString, bool> m_animated; // by local file path
+};
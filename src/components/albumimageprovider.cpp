@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "albumimageprovider.h"
+#include "albumimagecache.h"
+
+#include <QQuickTextureFactory>
+#include <QRunnable>
+
+#include <atomic>
+
+namespace
+{
+class AlbumImageResponse : public QQuickImageResponse, public QRunnable
+{
+public:
+    AlbumImageResponse(const QUrl &source, const QSize &requestedSize)
+        : m_source(source)
+        , m_requestedSize(requestedSize)
+    {
+        // Deleted by the engine once finished.
+        setAutoDelete(false);
+    }
+
+    QQuickTextureFactory *textureFactory() const override
+    {
+        return QQuickTextureFactory::textureFactoryForImage(m_image);
+    }
+
+    QString errorString() const override
+    {
+        return m_errorString;
+    }
+
+    void cancel() override
+    {
+        m_cancelled = true;
+    }
+
+    void run() override
+    {
+        if (!m_cancelled) {
+            auto cache = AlbumImageCache::instance();
+            const QString key = AlbumImageCache::cacheKey(m_source, m_requestedSize);
+            if (!cache->find(key, &m_image)) {
+                QSize originalSize;
+                m_image = AlbumImageCache::decode(m_source, m_requestedSize, &originalSize);
+                cache->insert(key, m_image, originalSize);
+            }
+            if (m_image.isNull()) {
+                m_errorString = QStringLiteral("Unable to load %1").arg(m_source.toDisplayString());
+            }
+        }
+        Q_EMIT finished();
+    }
+
+private:
+    const QUrl m_source;
+    const QSize m_requestedSize;
+    std::atomic_bool m_cancelled = false;
+    QImage m_image;
+    QString m_errorString;
+};
+}
+
+AlbumImageProvider::AlbumImageProvider()
+{
+    m_pool.setMaxThreadCount(2);
+}
+
+QQuickImageResponse *AlbumImageProvider::requestImageResponse(const QString &id, const QSize &requestedSize)
+{
+    auto response = new AlbumImageResponse(AlbumImageCache::sourceFromId(id), requestedSize);
+    m_pool.start(response);
+    return response;
+}
@@ -0,0 +1,22 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QQuickAsyncImageProvider>
+#include <QThreadPool>
+
+/**
+ * @brief Serves album images from AlbumImageCache, decoding them in the
+ * background at the requested size on a miss.
+ */
+class AlbumImageProvider : public QQuickAsyncImageProvider
+{
+public:
+    AlbumImageProvider();
+
+    QQuickImageResponse *requestImageResponse(const QString &id, const QSize &requestedSize) override;
+
+private:
+    QThreadPool m_pool;
+};
@@ -0,0 +1,261 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "albummodel.h"
+
+#include <QCollator>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QImageReader>
+#include <QMimeDatabase>
+
+#include <algorithm>
+
+namespace
+{
+// Rows are handed over when this many files were probed or this much time passed.
+constexpr int BatchSize = 64;
+constexpr int BatchInterval = 50;
+}
+
+AlbumModel::AlbumModel(QObject *parent)
+    : QAbstractListModel(parent)
+    , m_generation(std::make_shared<std::atomic<quint64>>(0))
+{
+    // Probing is I/O bound, reading the files in order is the fastest on spinning disks.
+    m_pool.setMaxThreadCount(1);
+}
+
+AlbumModel::~AlbumModel()
+{
+    ++*m_generation;
+    m_pool.clear();
+    m_pool.waitForDone();
+}
+
+QUrl AlbumModel::folder() const
+{
+    return m_folder;
+}
+
+void AlbumModel::setFolder(const QUrl &folder)
+{
+    if (m_folder == folder) {
+        return;
+    }
+    m_folder = folder;
+    Q_EMIT folderChanged();
+
+    if (!m_sources.isEmpty()) {
+        m_sources.clear();
+        Q_EMIT sourcesChanged();
+    }
+
+    load();
+}
+
+QList<QUrl> AlbumModel::sources() const
+{
+    return m_sources;
+}
+
+void AlbumModel::setSources(const QList<QUrl> &sources)
+{
+    if (m_sources == sources) {
+        return;
+    }
+    m_sources = sources;
+    Q_EMIT sourcesChanged();
+
+    if (!m_folder.isEmpty()) {
+        m_folder.clear();
+        Q_EMIT folderChanged();
+    }
+
+    load();
+}
+
+bool AlbumModel::isLoading() const
+{
+    return m_loading;
+}
+
+void AlbumModel::setLoading(bool loading)
+{
+    if (m_loading == loading) {
+        return;
+    }
+    m_loading = loading;
+    Q_EMIT loadingChanged();
+}
+
+QVariant AlbumModel::data(const QModelIndex &index, int role) const
+{
+    if (!checkIndex(index, QAbstractItemModel::CheckIndexOption::IndexIsValid)) {
+        return {};
+    }
+
+    const Item &item = m_items.at(index.row());
+    switch (role) {
+    case SourceRole:
+        return item.source;
+    case SourceWidthRole:
+        return qreal(std::max(item.sourceSize.width(), 0));
+    case SourceHeightRole:
+        return qreal(std::max(item.sourceSize.height(), 0));
+    case TempSourceRole:
+        return QUrl();
+    case TypeRole:
+        return item.type;
+    case CaptionRole:
+        return item.caption;
+    }
+
+    return {};
+}
+
+int AlbumModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_items.size();
+}
+
+QHash<int, QByteArray> AlbumModel::roleNames() const
+{
+    return {
+        {SourceRole, QByteArrayLiteral("source")},
+        {SourceWidthRole, QByteArrayLiteral("sourceWidth")},
+        {SourceHeightRole, QByteArrayLiteral("sourceHeight")},
+        {TempSourceRole, QByteArrayLiteral("tempSource")},
+        {TypeRole, QByteArrayLiteral("type")},
+        {CaptionRole, QByteArrayLiteral("caption")},
+    };
+}
+
+void AlbumModel::load()
+{
+    const quint64 generation = ++*m_generation;
+    m_pool.clear();
+
+    if (!m_items.isEmpty()) {
+        beginResetModel();
+        m_items.clear();
+        endResetModel();
+        Q_EMIT countChanged();
+    }
+
+    if (m_folder.isEmpty() && m_sources.isEmpty()) {
+        setLoading(false);
+        return;
+    }
+    setLoading(true);
+
+    m_pool.start([this, folder = m_folder, sources = m_sources, currentGeneration = m_generation, generation] {
+        const bool mediaOnly = !folder.isEmpty();
+        const QList<QUrl> urls = mediaOnly ? listFolder(folder, *currentGeneration, generation) : sources;
+
+        QList<Item> batch;
+        QElapsedTimer timer;
+        timer.start();
+
+        for (const QUrl &url : urls) {
+            if (*currentGeneration != generation) {
+                return;
+            }
+
+            Item item;
+            if (probe(url, &item, mediaOnly)) {
+                batch.append(item);
+            }
+
+            if (batch.size() >= BatchSize || (!batch.isEmpty() && timer.elapsed() >= BatchInterval)) {
+                QMetaObject::invokeMethod(this, [this, generation, batch] { appendItems(generation, batch); }, Qt::QueuedConnection);
+                batch.clear();
+                timer.restart();
+            }
+        }
+
+        QMetaObject::invokeMethod(
+            this,
+            [this, generation, batch] {
+                appendItems(generation, batch);
+                finishLoading(generation);
+            },
+            Qt::QueuedConnection);
+    });
+}
+
+QList<QUrl> AlbumModel::listFolder(const QUrl &folder, const std::atomic<quint64> &generation, quint64 current)
+{
+    QDir dir(folder.toLocalFile());
+    QFileInfoList entries = dir.entryInfoList(QDir::Files | QDir::Readable);
+
+    QCollator collator;
+    collator.setNumericMode(true);
+    std::sort(entries.begin(), entries.end(), [&collator](const QFileInfo &left, const QFileInfo &right) {
+        return collator.compare(left.fileName(), right.fileName()) < 0;
+    });
+
+    QList<QUrl> urls;
+    urls.reserve(entries.size());
+    for (const QFileInfo &entry : std::as_const(entries)) {
+        if (generation != current) {
+            return {};
+        }
+        urls.append(QUrl::fromLocalFile(entry.absoluteFilePath()));
+    }
+    return urls;
+}
+
+bool AlbumModel::probe(const QUrl &source, Item *item, bool mediaOnly)
+{
+    static const QMimeDatabase mimeDatabase;
+
+    item->source = source;
+    item->caption = source.fileName();
+
+    const QMimeType mimeType = mimeDatabase.mimeTypeForFile(source.isLocalFile() ? source.toLocalFile() : source.path(), QMimeDatabase::MatchExtension);
+    const QString mimeName = mimeType.name();
+    if (mimeName.startsWith(QLatin1String("video/")) && !mimeType.inherits(QStringLiteral("video/x-mng"))) {
+        item->type = Video;
+        return true;
+    }
+
+    item->type = Image;
+    if (mediaOnly && !mimeName.startsWith(QLatin1String("image/"))) {
+        return false;
+    }
+
+    if (source.isLocalFile()) {
+        // Only reads the header.
+        QImageReader reader(source.toLocalFile());
+        item->sourceSize = reader.size();
+        if (mediaOnly && !item->sourceSize.isValid() && !reader.canRead()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void AlbumModel::appendItems(quint64 generation, const QList<Item> &items)
+{
+    if (generation != *m_generation || items.isEmpty()) {
+        return;
+    }
+
+    beginInsertRows({}, m_items.size(), m_items.size() + items.size() - 1);
+    m_items.append(items);
+    endInsertRows();
+    Q_EMIT countChanged();
+}
+
+void AlbumModel::finishLoading(quint64 generation)
+{
+    if (generation != *m_generation) {
+        return;
+    }
+    setLoading(false);
+}
+
+#include "moc_albummodel.cpp"
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QAbstractListModel>
+#include <QList>
+#include <QThreadPool>
+#include <QUrl>
+
+#include <atomic>
+#include <memory>
+
+/**
+ * @class AlbumModel
+ *
+ * A model providing the roles required by AlbumMaximizeComponent for a
+ * folder or a list of files.
+ *
+ * Files are inspected in a background thread: the media type is guessed from
+ * the file name and image dimensions are read from the file header only, the
+ * images are never decoded. Rows are appended in batches as files are probed,
+ * so the first items can be shown before a large folder is fully read.
+ *
+ * Example:
+ * @code
+ * Components.AlbumMaximizeComponent {
+ *     model: Components.AlbumModel {
+ *         folder: "file:///home/user/Pictures"
+ *     }
+ * }
+ * @endcode
+ */
+class AlbumModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+    /**
+     * @brief A folder whose images and videos are shown, sorted by name.
+     *
+     * Setting it replaces the content of the model.
+     */
+    Q_PROPERTY(QUrl folder READ folder WRITE setFolder NOTIFY folderChanged)
+
+    /**
+     * @brief The files shown in the model, in order.
+     *
+     * Setting it replaces the content of the model.
+     */
+    Q_PROPERTY(QList<QUrl> sources READ sources WRITE setSources NOTIFY sourcesChanged)
+
+    /**
+     * @brief Whether files are still being probed.
+     */
+    Q_PROPERTY(bool loading READ isLoading NOTIFY loadingChanged)
+
+    /**
+     * @brief The number of rows in the model.
+     */
+    Q_PROPERTY(int count READ rowCount NOTIFY countChanged)
+
+public:
+    /**
+     * @brief Defines the model roles.
+     *
+     * The same roles as ExampleAlbumModel in the tests.
+     */
+    enum Roles {
+        SourceRole = Qt::DisplayRole, /**< The source for the item. */
+        SourceWidthRole, /**< The width of the image as stored in the file, 0 if unknown. */
+        SourceHeightRole, /**< The height of the image as stored in the file, 0 if unknown. */
+        TempSourceRole, /**< Source for the temporary content, always empty. */
+        TypeRole, /**< The delegate type that should be shown for this item. */
+        CaptionRole, /**< The file name. */
+    };
+    Q_ENUM(Roles)
+
+    /**
+     * @brief The media type for the album item, same values as AlbumModelItem.Type.
+     */
+    enum Type {
+        Image = 0, /**< The media has an image or animated image mime type. */
+        Video, /**< The media has a video mime type. */
+    };
+    Q_ENUM(Type)
+
+    explicit AlbumModel(QObject *parent = nullptr);
+    ~AlbumModel() override;
+
+    QUrl folder() const;
+    void setFolder(const QUrl &folder);
+
+    QList<QUrl> sources() const;
+    void setSources(const QList<QUrl> &sources);
+
+    bool isLoading() const;
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+Q_SIGNALS:
+    void folderChanged();
+    void sourcesChanged();
+    void loadingChanged();
+    void countChanged();
+
+private:
+    struct Item {
+        QUrl source;
+        QSize sourceSize;
+        Type type = Image;
+        QString caption;
+    };
+
+    void load();
+    void appendItems(quint64 generation, const QList<Item> &items);
+    void finishLoading(quint64 generation);
+    void setLoading(bool loading);
+
+    static QList<QUrl> listFolder(const QUrl &folder, const std::atomic<quint64> &generation, quint64 current);
+    static bool probe(const QUrl &source, Item *item, bool mediaOnly);
+
+    QUrl m_folder;
+    QList<QUrl> m_sources;
+    QList<Item> m_items;
+    bool m_loading = false;
+
+    QThreadPool m_pool;
+    // Bumped on every reload, results of older loads are dropped.
+    std::shared_ptr<std::atomic<quint64>> m_generation;
+};
@@ -0,0 +1,314 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "albumprefetcher.h"
+#include "albumimagecache.h"
+
+#include <QAbstractItemModel>
+#include <QJSValue>
+#include <QQmlListReference>
+#include <QSet>
+#include <QThread>
+
+namespace
+{
+// Matches AlbumModelItem.Image
+constexpr int ImageType = 0;
+}
+
+AlbumPrefetcher::AlbumPrefetcher(QObject *parent)
+    : QObject(parent)
+{
+    // Leave room for the image provider serving the visible item.
+    m_pool.setMaxThreadCount(qMax(1, QThread::idealThreadCount() / 2));
+
+    // Coalesce the property changes of a single flick into one update.
+    m_updateTimer.setSingleShot(true);
+    m_updateTimer.setInterval(0);
+    connect(&m_updateTimer, &QTimer::timeout, this, &AlbumPrefetcher::update);
+
+    // Resizing the window changes the size on every step, only decode for the final one.
+    m_targetSizeTimer.setSingleShot(true);
+    m_targetSizeTimer.setInterval(200);
+    connect(&m_targetSizeTimer, &QTimer::timeout, this, [this] {
+        m_appliedTargetSize = m_targetSize;
+        scheduleUpdate();
+    });
+}
+
+AlbumPrefetcher::~AlbumPrefetcher()
+{
+    cancelAll();
+    m_pool.clear();
+    m_pool.waitForDone();
+}
+
+QVariant AlbumPrefetcher::model() const
+{
+    return m_model;
+}
+
+void AlbumPrefetcher::setModel(const QVariant &model)
+{
+    if (m_model == model) {
+        return;
+    }
+
+    if (m_itemModel) {
+        disconnect(m_itemModel, nullptr, this, nullptr);
+    }
+
+    m_model = model;
+    m_itemModel = qobject_cast<QAbstractItemModel *>(model.value<QObject *>());
+    m_sourceRole = -1;
+    m_typeRole = -1;
+
+    if (m_itemModel) {
+        const auto roleNames = m_itemModel->roleNames();
+        m_sourceRole = roleNames.key(QByteArrayLiteral("source"), -1);
+        m_typeRole = roleNames.key(QByteArrayLiteral("type"), -1);
+
+        connect(m_itemModel, &QAbstractItemModel::rowsInserted, this, &AlbumPrefetcher::scheduleUpdate);
+        connect(m_itemModel, &QAbstractItemModel::rowsRemoved, this, &AlbumPrefetcher::scheduleUpdate);
+        connect(m_itemModel, &QAbstractItemModel::rowsMoved, this, &AlbumPrefetcher::scheduleUpdate);
+        connect(m_itemModel, &QAbstractItemModel::dataChanged, this, &AlbumPrefetcher::scheduleUpdate);
+        connect(m_itemModel, &QAbstractItemModel::modelReset, this, [this] {
+            const auto roleNames = m_itemModel->roleNames();
+            m_sourceRole = roleNames.key(QByteArrayLiteral("source"), -1);
+            m_typeRole = roleNames.key(QByteArrayLiteral("type"), -1);
+            scheduleUpdate();
+        });
+    }
+
+    cancelAll();
+    scheduleUpdate();
+    Q_EMIT modelChanged();
+}
+
+int AlbumPrefetcher::currentIndex() const
+{
+    return m_currentIndex;
+}
+
+void AlbumPrefetcher::setCurrentIndex(int currentIndex)
+{
+    if (m_currentIndex == currentIndex) {
+        return;
+    }
+    m_currentIndex = currentIndex;
+    scheduleUpdate();
+    Q_EMIT currentIndexChanged();
+}
+
+int AlbumPrefetcher::prefetchCount() const
+{
+    return m_prefetchCount;
+}
+
+void AlbumPrefetcher::setPrefetchCount(int prefetchCount)
+{
+    if (m_prefetchCount == prefetchCount) {
+        return;
+    }
+    m_prefetchCount = prefetchCount;
+    scheduleUpdate();
+    Q_EMIT prefetchCountChanged();
+}
+
+QSize AlbumPrefetcher::targetSize() const
+{
+    return m_targetSize;
+}
+
+void AlbumPrefetcher::setTargetSize(const QSize &targetSize)
+{
+    if (m_targetSize == targetSize) {
+        return;
+    }
+    m_targetSize = targetSize;
+    if (m_appliedTargetSize.isEmpty()) {
+        // Nothing to wait for the first time.
+        m_appliedTargetSize = targetSize;
+        scheduleUpdate();
+    } else {
+        // Jobs for the old size keep running until then, update() cancels them.
+        m_targetSizeTimer.start();
+    }
+    Q_EMIT targetSizeChanged();
+}
+
+qreal AlbumPrefetcher::devicePixelRatio() const
+{
+    return m_devicePixelRatio;
+}
+
+void AlbumPrefetcher::setDevicePixelRatio(qreal devicePixelRatio)
+{
+    if (qFuzzyCompare(m_devicePixelRatio, devicePixelRatio)) {
+        return;
+    }
+    m_devicePixelRatio = devicePixelRatio;
+    cancelAll();
+    scheduleUpdate();
+    Q_EMIT devicePixelRatioChanged();
+}
+
+bool AlbumPrefetcher::isEnabled() const
+{
+    return m_enabled;
+}
+
+void AlbumPrefetcher::setEnabled(bool enabled)
+{
+    if (m_enabled == enabled) {
+        return;
+    }
+    m_enabled = enabled;
+    if (m_enabled) {
+        scheduleUpdate();
+    } else {
+        cancelAll();
+    }
+    Q_EMIT enabledChanged();
+}
+
+void AlbumPrefetcher::scheduleUpdate()
+{
+    m_updateTimer.start();
+}
+
+void AlbumPrefetcher::cancelAll()
+{
+    for (const auto &cancelled : std::as_const(m_jobs)) {
+        *cancelled = true;
+    }
+    m_jobs.clear();
+}
+
+int AlbumPrefetcher::rowCount() const
+{
+    if (m_itemModel) {
+        return m_itemModel->rowCount();
+    }
+    if (m_model.metaType() == QMetaType::fromType<QQmlListReference>()) {
+        return m_model.value<QQmlListReference>().count();
+    }
+    if (m_model.metaType() == QMetaType::fromType<QJSValue>()) {
+        return m_model.value<QJSValue>().property(QStringLiteral("length")).toInt();
+    }
+    if (m_model.canConvert<QVariantList>()) {
+        return m_model.toList().size();
+    }
+    return 0;
+}
+
+QUrl AlbumPrefetcher::imageSourceAt(int row) const
+{
+    QVariant source;
+    QVariant type;
+
+    if (m_itemModel) {
+        if (m_sourceRole < 0) {
+            return {};
+        }
+        const QModelIndex index = m_itemModel->index(row, 0);
+        source = index.data(m_sourceRole);
+        if (m_typeRole >= 0) {
+            type = index.data(m_typeRole);
+        }
+    } else if (m_model.metaType() == QMetaType::fromType<QQmlListReference>()) {
+        if (const QObject *item = m_model.value<QQmlListReference>().at(row)) {
+            source = item->property("source");
+            type = item->property("type");
+        }
+    } else if (m_model.metaType() == QMetaType::fromType<QJSValue>()) {
+        const QJSValue item = m_model.value<QJSValue>().property(row);
+        source = item.property(QStringLiteral("source")).toVariant();
+        type = item.property(QStringLiteral("type")).toVariant();
+    } else {
+        const QVariant item = m_model.toList().value(row);
+        if (const QObject *object = item.value<QObject *>()) {
+            source = object->property("source");
+            type = object->property("type");
+        } else {
+            const QVariantMap map = item.toMap();
+            source = map.value(QStringLiteral("source"));
+            type = map.value(QStringLiteral("type"));
+        }
+    }
+
+    if (type.isValid() && type.toInt() != ImageType) {
+        return {};
+    }
+    return source.toUrl();
+}
+
+void AlbumPrefetcher::update()
+{
+    const int count = rowCount();
+    if (!m_enabled || m_currentIndex < 0 || m_currentIndex >= count || m_appliedTargetSize.isEmpty()) {
+        cancelAll();
+        return;
+    }
+
+    // Must match what Image.sourceSize turns into for the provider.
+    const QSize requestedSize = m_appliedTargetSize * m_devicePixelRatio;
+    auto cache = AlbumImageCache::instance();
+
+    QSet<QString> wanted;
+    // The current item is requested by its delegate, start with its direct neighbours.
+    for (int distance = 1; distance <= m_prefetchCount; ++distance) {
+        for (const int row : {m_currentIndex + distance, m_currentIndex - distance}) {
+            if (row < 0 || row >= count) {
+                continue;
+            }
+
+            const QUrl source = imageSourceAt(row);
+            if (!cache->isCacheable(source)) {
+                continue;
+            }
+
+            const QString key = AlbumImageCache::cacheKey(source, requestedSize);
+            wanted.insert(key);
+            if (m_jobs.contains(key) || cache->contains(key)) {
+                continue;
+            }
+
+            auto cancelled = std::make_shared<std::atomic_bool>(false);
+            m_jobs.insert(key, cancelled);
+            m_pool.start(
+                [this, source, requestedSize, key, cancelled] {
+                    if (!*cancelled && !AlbumImageCache::instance()->contains(key)) {
+                        QSize originalSize;
+                        const QImage image = AlbumImageCache::decode(source, requestedSize, &originalSize);
+                        // The user may have skipped past this item while it was decoded.
+                        if (!*cancelled) {
+                            AlbumImageCache::instance()->insert(key, image, originalSize);
+                        }
+                    }
+                    QMetaObject::invokeMethod(
+                        this,
+                        [this, key, cancelled] {
+                            if (m_jobs.value(key) == cancelled) {
+                                m_jobs.remove(key);
+                            }
+                        },
+                        Qt::QueuedConnection);
+                },
+                // Closest items first.
+                m_prefetchCount - distance);
+        }
+    }
+
+    // Drop everything the user has skipped past, queued jobs return immediately.
+    for (auto it = m_jobs.begin(); it != m_jobs.end();) {
+        if (!wanted.contains(it.key())) {
+            *it.value() = true;
+            it = m_jobs.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+#include "moc_albumprefetcher.cpp"
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QSize>
+#include <QThreadPool>
+#include <QTimer>
+#include <QUrl>
+#include <QVariant>
+
+#include <atomic>
+#include <memory>
+
+class QAbstractItemModel;
+
+/**
+ * @brief Decodes the images around the current item of an album ahead of time.
+ *
+ * The prefetchCount items before and after currentIndex are decoded in the
+ * background at the size they will be shown at and stored in AlbumImageCache,
+ * so flicking to them does not stall on a full resolution decode. Work for
+ * items that moved out of that window is cancelled.
+ *
+ * The model can be anything accepted by AlbumMaximizeComponent: a
+ * QAbstractItemModel, a list of AlbumModelItem or a JavaScript array, as long
+ * as it provides the source and type roles.
+ */
+class AlbumPrefetcher : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(QVariant model READ model WRITE setModel NOTIFY modelChanged)
+    Q_PROPERTY(int currentIndex READ currentIndex WRITE setCurrentIndex NOTIFY currentIndexChanged)
+    Q_PROPERTY(int prefetchCount READ prefetchCount WRITE setPrefetchCount NOTIFY prefetchCountChanged)
+    Q_PROPERTY(QSize targetSize READ targetSize WRITE setTargetSize NOTIFY targetSizeChanged)
+    Q_PROPERTY(qreal devicePixelRatio READ devicePixelRatio WRITE setDevicePixelRatio NOTIFY devicePixelRatioChanged)
+    Q_PROPERTY(bool enabled READ isEnabled WRITE setEnabled NOTIFY enabledChanged)
+
+public:
+    explicit AlbumPrefetcher(QObject *parent = nullptr);
+    ~AlbumPrefetcher() override;
+
+    QVariant model() const;
+    void setModel(const QVariant &model);
+
+    int currentIndex() const;
+    void setCurrentIndex(int currentIndex);
+
+    /// Number of items decoded on each side of the current one, default 2.
+    int prefetchCount() const;
+    void setPrefetchCount(int prefetchCount);
+
+    /// Size of the item the images are shown in, in logical pixels.
+    /// The images are decoded for a new size once it stops changing for a moment.
+    QSize targetSize() const;
+    void setTargetSize(const QSize &targetSize);
+
+    qreal devicePixelRatio() const;
+    void setDevicePixelRatio(qreal devicePixelRatio);
+
+    bool isEnabled() const;
+    void setEnabled(bool enabled);
+
+Q_SIGNALS:
+    void modelChanged();
+    void currentIndexChanged();
+    void prefetchCountChanged();
+    void targetSizeChanged();
+    void devicePixelRatioChanged();
+    void enabledChanged();
+
+private:
+    using CancelFlag = std::shared_ptr<std::atomic_bool>;
+
+    void scheduleUpdate();
+    void update();
+    void cancelAll();
+    int rowCount() const;
+    QUrl imageSourceAt(int row) const;
+
+    QVariant m_model;
+    QPointer<QAbstractItemModel> m_itemModel;
+    int m_sourceRole = -1;
+    int m_typeRole = -1;
+
+    int m_currentIndex = -1;
+    int m_prefetchCount = 2;
+    QSize m_targetSize;
+    QSize m_appliedTargetSize; // m_targetSize once it settled, used for decoding
+    qreal m_devicePixelRatio = 1.0;
+    bool m_enabled = true;
+
+    QTimer m_updateTimer;
+    QTimer m_targetSizeTimer;
+    QThreadPool m_pool;
+    QHash<QString, CancelFlag> m_jobs; // cache key -> queued or running job
+};
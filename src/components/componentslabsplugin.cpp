@@ -4,7 +4,12 @@
 
 #include <QQmlExtensionPlugin>
 #include <QQmlEngine>
+#include "albumimagecache.h"
+#include "albumimageprovider.h"
+#include "albummodel.h"
+#include "albumprefetcher.h"
 #include "nameutils.h"
+#include "tiledimageitem.h"
 
 class ComponentsLabsPlugin : public QQmlExtensionPlugin
 {
@@ -14,12 +19,21 @@ class ComponentsLabsPlugin : public QQmlExtensionPlugin
 public:
     ComponentsLabsPlugin() = default;
     ~ComponentsLabsPlugin() = default;
+    void initializeEngine(QQmlEngine *engine, const char *uri) override
+    {
+        Q_UNUSED(uri)
+        engine->addImageProvider(AlbumImageCache::providerId(), new AlbumImageProvider);
+    }
     void registerTypes(const char *uri) override
     {
         qmlRegisterModule(uri, 1, 0);
         qmlRegisterSingletonType<NameUtils>(uri, 1, 0, "NameUtils", [](QQmlEngine*, QJSEngine*) -> QObject* {
             return new NameUtils;
         });
+        qmlRegisterSingletonInstance<AlbumImageCache>(uri, 1, 0, "AlbumImageCache", AlbumImageCache::instance());
+        qmlRegisterType<AlbumModel>(uri, 1, 0, "AlbumModel");
+        qmlRegisterType<AlbumPrefetcher>(uri, 1, 0, "AlbumPrefetcher");
+        qmlRegisterType<TiledImageItem>(uri, 1, 0, "TiledImageItem");
     }
 };
 
@@ -2,19 +2,42 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #include "messagedialoghelper.h"
-#include <KConfigGroup>
+
+#include <QCoreApplication>
 
 using namespace Qt::StringLiterals;
 
+namespace
+{
+constexpr auto groupName = "Notification Messages"_L1;
+}
+
 MessageDialogHelper::MessageDialogHelper(QObject *parent)
     : QObject(parent)
 {
+    m_flushTimer.setSingleShot(true);
+    m_flushTimer.setInterval(500);
+    connect(&m_flushTimer, &QTimer::timeout, this, &MessageDialogHelper::flush);
+
+    m_writer.setMaxThreadCount(1);
+
+    if (QCoreApplication::instance()) {
+        connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, this, [this] {
+            flush();
+            m_writer.waitForDone();
+        });
+    }
+}
+
+MessageDialogHelper::~MessageDialogHelper()
+{
+    flush();
+    m_writer.waitForDone();
 }
 
 QJsonObject MessageDialogHelper::shouldBeShownTwoActions(const QString &dontShowAgainName)
 {
-    KConfigGroup cg(m_config ? m_config : KSharedConfig::openConfig().data(), QStringLiteral("Notification Messages"));
-    const QString dontAsk = cg.readEntry(dontShowAgainName, QString()).toLower();
+    const QString dontAsk = decision(dontShowAgainName).toLower();
     if (dontAsk == QLatin1StringView("yes") || dontAsk == QLatin1StringView("true")) {
         return {
             { "result"_L1, true },
@@ -35,30 +58,22 @@ QJsonObject MessageDialogHelper::shouldBeShownTwoActions(const QString &dontShow
 
 bool MessageDialogHelper::shouldBeShownContinue(const QString &dontShowAgainName)
 {
-    KConfigGroup cg(m_config ? m_config : KSharedConfig::openConfig().data(), QStringLiteral("Notification Messages"));
-    return cg.readEntry(dontShowAgainName, true);
+    // Same parsing as KConfigGroup::readEntry(key, true).
+    const QString show = decision(dontShowAgainName).toLower();
+    if (show.isEmpty()) {
+        return true;
+    }
+    return show == "true"_L1 || show == "on"_L1 || show == "yes"_L1 || show == "1"_L1;
 }
 
 void MessageDialogHelper::saveDontShowAgainTwoActions(const QString &dontShowAgainName, bool result)
 {
-    KConfigGroup::WriteConfigFlags flags = KConfig::Persistent;
-    if (dontShowAgainName[0] == QLatin1Char(':')) {
-        flags |= KConfigGroup::Global;
-    }
-    KConfigGroup cg(m_config ? m_config : KSharedConfig::openConfig().data(), QStringLiteral("Notification Messages"));
-    cg.writeEntry(dontShowAgainName, result, flags);
-    cg.sync();
+    saveDecision(dontShowAgainName, result);
 }
 
 void MessageDialogHelper::saveDontShowAgainContinue(const QString &dontShowAgainName)
 {
-    KConfigGroup::WriteConfigFlags flags = KConfigGroup::Persistent;
-    if (dontShowAgainName[0] == QLatin1Char(':')) {
-        flags |= KConfigGroup::Global;
-    }
-    KConfigGroup cg(m_config ? m_config : KSharedConfig::openConfig().data(), QStringLiteral("Notification Messages"));
-    cg.writeEntry(dontShowAgainName, false, flags);
-    cg.sync();
+    saveDecision(dontShowAgainName, false);
 }
 
 KConfig *MessageDialogHelper::config() const
@@ -71,6 +86,68 @@ void MessageDialogHelper::setConfig(KConfig *config)
     if (m_config == config) {
         return;
     }
+    // The pending decisions belong to the previous config.
+    flush();
     m_config = config;
     Q_EMIT configChanged();
 }
+
+KConfig *MessageDialogHelper::effectiveConfig()
+{
+    if (m_config) {
+        return m_config;
+    }
+    if (!m_sharedConfig) {
+        m_sharedConfig = KSharedConfig::openConfig();
+    }
+    return m_sharedConfig.data();
+}
+
+QString MessageDialogHelper::decision(const QString &dontShowAgainName)
+{
+    // KConfig holds the entries in memory already, and sees resets such as KMessageBox::enableAllMessages().
+    KConfigGroup cg(effectiveConfig(), groupName);
+    return cg.readEntry(dontShowAgainName, QString());
+}
+
+void MessageDialogHelper::saveDecision(const QString &dontShowAgainName, bool value)
+{
+    KConfigGroup::WriteConfigFlags flags = KConfigGroup::Persistent;
+    if (dontShowAgainName[0] == QLatin1Char(':')) {
+        flags |= KConfigGroup::Global;
+    }
+
+    // Let the config used by the application see the decision right away, without saving it from this thread.
+    KConfig *config = effectiveConfig();
+    KConfigGroup cg(config, groupName);
+    cg.writeEntry(dontShowAgainName, value, config->name().isEmpty() ? flags : flags & ~KConfigGroup::Persistent);
+    if (config->name().isEmpty()) {
+        // Not backed by a file, there is nothing to save.
+        return;
+    }
+
+    m_pendingWrites.insert(dontShowAgainName, {value, flags});
+    m_flushTimer.start();
+}
+
+void MessageDialogHelper::flush()
+{
+    m_flushTimer.stop();
+    if (m_pendingWrites.isEmpty()) {
+        return;
+    }
+    const auto pendingWrites = std::exchange(m_pendingWrites, {});
+    const KConfig *config = effectiveConfig();
+
+    // KConfig is not thread safe, so the writer thread saves through its own instance of the same file.
+    m_writer.start([name = config->name(), openFlags = config->openFlags(), location = config->locationType(), pendingWrites] {
+        KConfig config(name, openFlags, location);
+        KConfigGroup cg(&config, groupName);
+        for (auto it = pendingWrites.cbegin(); it != pendingWrites.cend(); ++it) {
+            cg.writeEntry(it.key(), it.value().first, it.value().second);
+        }
+        config.sync();
+    });
+}
+
+#include "moc_messagedialoghelper.cpp"
@@ -5,10 +5,19 @@
 
 #include <QObject>
 #include <QtQml/qqmlregistration.h>
+#include <KConfigGroup>
 #include <KSharedConfig>
+#include <QHash>
 #include <QJsonObject>
+#include <QThreadPool>
+#include <QTimer>
 
 /// @internal Only used by MessageDialog
+///
+/// The "don't show again" decisions are read through the config, which keeps
+/// them in memory. Saving a decision only updates the config in memory; the
+/// writes to the file are gathered and saved in a background thread shortly
+/// after, and when the application quits.
 class MessageDialogHelper : public QObject
 {
     Q_OBJECT
@@ -18,6 +27,7 @@ class MessageDialogHelper : public QObject
 
 public:
     explicit MessageDialogHelper(QObject *parent = nullptr);
+    ~MessageDialogHelper() override;
 
     KConfig *config() const;
     void setConfig(KConfig *config);
@@ -34,5 +44,15 @@ Q_SIGNALS:
     void configChanged();
 
 private:
+    KConfig *effectiveConfig();
+    QString decision(const QString &dontShowAgainName);
+    void saveDecision(const QString &dontShowAgainName, bool value);
+    void flush();
+
     KConfig *m_config = nullptr;
+    KSharedConfigPtr m_sharedConfig;
+
+    QHash<QString, std::pair<bool, KConfigGroup::WriteConfigFlags>> m_pendingWrites;
+    QTimer m_flushTimer;
+    QThreadPool m_writer; // a single thread, so that the writes are saved in order
 };
@@ -0,0 +1,352 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "tiledimageitem.h"
+#include "albumimagecache.h"
+
+#include <QImageIOHandler>
+#include <QImageReader>
+#include <QQuickWindow>
+#include <QPointer>
+#include <QSGSimpleTextureNode>
+#include <QSet>
+#include <QThreadPool>
+
+#include <cmath>
+
+namespace
+{
+constexpr int TileSize = 512;
+
+// Shared by all items so that concurrent decodes stay bounded.
+Q_GLOBAL_STATIC(QThreadPool, tilePool)
+
+class TileRootNode : public QSGNode
+{
+public:
+    QHash<QString, QSGSimpleTextureNode *> tiles;
+};
+
+QString tileKey(const QUrl &source, int level, int column, int row)
+{
+    return source.toString() + QStringLiteral("#tile/%1/%2/%3").arg(level).arg(column).arg(row);
+}
+
+QString levelKey(const QUrl &source, int level)
+{
+    return source.toString() + QStringLiteral("#level/%1").arg(level);
+}
+
+QSize scaledDown(const QSize &size, int level)
+{
+    const int factor = 1 << level;
+    return QSize((size.width() + factor - 1) / factor, (size.height() + factor - 1) / factor);
+}
+}
+
+TiledImageItem::TiledImageItem(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+    setFlag(ItemHasContents);
+    tilePool->setMaxThreadCount(2);
+}
+
+TiledImageItem::~TiledImageItem()
+{
+    cancelAll();
+}
+
+QUrl TiledImageItem::source() const
+{
+    return m_source;
+}
+
+void TiledImageItem::setSource(const QUrl &source)
+{
+    if (m_source == source) {
+        return;
+    }
+    m_source = source;
+    cancelAll();
+
+    const bool hadSize = m_sourceSize.isValid();
+    m_sourceSize = {};
+    m_visibleTiles.clear();
+    m_tilesChanged = true;
+    update();
+
+    probe();
+
+    Q_EMIT sourceChanged();
+    if (hadSize) {
+        Q_EMIT sourceSizeChanged();
+    }
+}
+
+QSize TiledImageItem::sourceSize() const
+{
+    return m_sourceSize;
+}
+
+qreal TiledImageItem::zoom() const
+{
+    return m_zoom;
+}
+
+void TiledImageItem::setZoom(qreal zoom)
+{
+    if (qFuzzyCompare(m_zoom, zoom)) {
+        return;
+    }
+    m_zoom = zoom;
+    polish();
+    Q_EMIT zoomChanged();
+}
+
+QQuickItem *TiledImageItem::viewport() const
+{
+    return m_viewport;
+}
+
+void TiledImageItem::setViewport(QQuickItem *viewport)
+{
+    if (m_viewport == viewport) {
+        return;
+    }
+    m_viewport = viewport;
+    polish();
+    Q_EMIT viewportChanged();
+}
+
+TiledImageItem::Status TiledImageItem::status() const
+{
+    return m_status;
+}
+
+void TiledImageItem::setStatus(Status status)
+{
+    if (m_status == status) {
+        return;
+    }
+    m_status = status;
+    Q_EMIT statusChanged();
+}
+
+void TiledImageItem::probe()
+{
+    if (!m_source.isLocalFile()) {
+        setStatus(m_source.isEmpty() ? Null : Error);
+        return;
+    }
+
+    setStatus(Loading);
+    const QUrl source = m_source;
+    tilePool->start([item = QPointer<TiledImageItem>(this), source] {
+        QImageReader reader(source.toLocalFile());
+        const QSize size = reader.size();
+        const bool supportsClipRect = reader.supportsOption(QImageIOHandler::ClipRect);
+        // Queued to the thread of the item; dropped if it is gone by then.
+        if (!item) {
+            return;
+        }
+        QMetaObject::invokeMethod(
+            item,
+            [item, source, size, supportsClipRect] {
+                item->probed(source, size, supportsClipRect);
+            },
+            Qt::QueuedConnection);
+    });
+}
+
+void TiledImageItem::probed(const QUrl &source, const QSize &size, bool supportsClipRect)
+{
+    if (source != m_source || m_status != Loading) {
+        return;
+    }
+
+    if (!size.isValid()) {
+        setStatus(Error);
+        return;
+    }
+
+    m_sourceSize = size;
+    m_supportsClipRect = supportsClipRect;
+    polish();
+    Q_EMIT sourceSizeChanged();
+    setStatus(Ready);
+}
+
+void TiledImageItem::tileLoaded(const QString &key)
+{
+    if (m_jobs.remove(key)) {
+        m_tilesChanged = true;
+        update();
+    }
+}
+
+void TiledImageItem::cancelAll()
+{
+    for (const auto &cancelled : std::as_const(m_jobs)) {
+        *cancelled = true;
+    }
+    m_jobs.clear();
+}
+
+void TiledImageItem::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size()) {
+        polish();
+    }
+}
+
+void TiledImageItem::itemChange(ItemChange change, const ItemChangeData &value)
+{
+    QQuickItem::itemChange(change, value);
+    if (change == ItemVisibleHasChanged || change == ItemSceneChange || change == ItemDevicePixelRatioHasChanged) {
+        polish();
+    }
+}
+
+void TiledImageItem::updatePolish()
+{
+    QList<Tile> tiles;
+
+    if (m_status == Ready && isVisible() && window() && width() > 0 && height() > 0) {
+        const QSizeF paintedSize = QSizeF(m_sourceSize).scaled(size(), Qt::KeepAspectRatio);
+        const QRectF paintedRect(QPointF((width() - paintedSize.width()) / 2, (height() - paintedSize.height()) / 2), paintedSize);
+
+        QRectF visibleRect = paintedRect;
+        if (m_viewport) {
+            // Takes the transforms into account, so a zoomed in item only loads its middle.
+            visibleRect &= mapRectFromItem(m_viewport, m_viewport->boundingRect());
+        }
+
+        if (!visibleRect.isEmpty()) {
+            // Device pixels per full resolution pixel.
+            const qreal scale = paintedSize.width() / m_sourceSize.width() * m_zoom * window()->effectiveDevicePixelRatio();
+            const int level = scale >= 1 ? 0 : int(std::floor(std::log2(1 / scale)));
+            const qreal itemPerSource = paintedSize.width() / m_sourceSize.width();
+            const QRect bounds(QPoint(0, 0), m_sourceSize);
+
+            if (m_supportsClipRect) {
+                const int extent = TileSize << level;
+                const QRectF visibleSource((visibleRect.topLeft() - paintedRect.topLeft()) / itemPerSource, visibleRect.size() / itemPerSource);
+                const int firstColumn = int(visibleSource.left()) / extent;
+                const int lastColumn = int(std::ceil(visibleSource.right())) / extent;
+                const int firstRow = int(visibleSource.top()) / extent;
+                const int lastRow = int(std::ceil(visibleSource.bottom())) / extent;
+
+                for (int row = firstRow; row <= lastRow; ++row) {
+                    for (int column = firstColumn; column <= lastColumn; ++column) {
+                        const QRect sourceRect = QRect(column * extent, row * extent, extent, extent) & bounds;
+                        if (sourceRect.isEmpty()) {
+                            continue;
+                        }
+                        const QRectF rect(paintedRect.topLeft() + QPointF(sourceRect.topLeft()) * itemPerSource, QSizeF(sourceRect.size()) * itemPerSource);
+                        tiles.append({tileKey(m_source, level, column, row), sourceRect, rect, level});
+                    }
+                }
+            } else {
+                tiles.append({levelKey(m_source, level), bounds, paintedRect, level});
+            }
+        }
+    }
+
+    // Start loading what is missing, drop what is no longer visible.
+    auto cache = AlbumImageCache::instance();
+    QSet<QString> wanted;
+    for (const Tile &tile : std::as_const(tiles)) {
+        wanted.insert(tile.key);
+        if (m_jobs.contains(tile.key) || cache->contains(tile.key)) {
+            continue;
+        }
+
+        auto cancelled = std::make_shared<std::atomic_bool>(false);
+        m_jobs.insert(tile.key, cancelled);
+        tilePool->start([item = QPointer<TiledImageItem>(this), source = m_source, tile, cancelled] {
+            if (*cancelled) {
+                return;
+            }
+
+            QImageReader reader(source.toLocalFile());
+            if (tile.sourceRect.size() != reader.size()) {
+                reader.setClipRect(tile.sourceRect);
+            }
+            reader.setScaledSize(scaledDown(tile.sourceRect.size(), tile.level));
+            const QImage image = reader.read();
+            if (*cancelled) {
+                return;
+            }
+            AlbumImageCache::instance()->insert(tile.key, image, tile.sourceRect.size());
+
+            if (!item) {
+                return;
+            }
+            QMetaObject::invokeMethod(
+                item,
+                [item, key = tile.key] {
+                    item->tileLoaded(key);
+                },
+                Qt::QueuedConnection);
+        });
+    }
+
+    for (auto it = m_jobs.begin(); it != m_jobs.end();) {
+        if (!wanted.contains(it.key())) {
+            *it.value() = true;
+            it = m_jobs.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    m_visibleTiles = tiles;
+    m_tilesChanged = true;
+    update();
+}
+
+QSGNode *TiledImageItem::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data)
+{
+    Q_UNUSED(data)
+
+    auto node = static_cast<TileRootNode *>(oldNode);
+    if (!node) {
+        node = new TileRootNode;
+    }
+
+    if (!m_tilesChanged) {
+        return node;
+    }
+    m_tilesChanged = false;
+
+    auto cache = AlbumImageCache::instance();
+    QHash<QString, QSGSimpleTextureNode *> tiles;
+    for (const Tile &tile : std::as_const(m_visibleTiles)) {
+        QSGSimpleTextureNode *tileNode = node->tiles.take(tile.key);
+        if (!tileNode) {
+            QImage image;
+            if (!cache->find(tile.key, &image)) {
+                continue;
+            }
+            tileNode = new QSGSimpleTextureNode;
+            tileNode->setOwnsTexture(true);
+            tileNode->setFiltering(QSGTexture::Linear);
+            tileNode->setTexture(window()->createTextureFromImage(image));
+            node->appendChildNode(tileNode);
+        }
+        tileNode->setRect(tile.rect);
+        tiles.insert(tile.key, tileNode);
+    }
+
+    // Whatever is left is no longer visible.
+    for (QSGSimpleTextureNode *tileNode : std::as_const(node->tiles)) {
+        node->removeChildNode(tileNode);
+        delete tileNode;
+    }
+    node->tiles = tiles;
+
+    return node;
+}
+
+#include "moc_tiledimageitem.cpp"
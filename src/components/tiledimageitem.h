@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QPointer>
+#include <QQuickItem>
+#include <QUrl>
+
+#include <atomic>
+#include <memory>
+
+/**
+ * @brief Draws the visible part of a large local image from tiles decoded at
+ * the resolution it is currently shown at.
+ *
+ * The image is split in power of two levels, level n being the image scaled
+ * down by 2^n, and each level in tiles of 512 pixels. Only the tiles of the
+ * level matching the current zoom that intersect the viewport are decoded, in
+ * the background, and stored in AlbumImageCache so they are shared with any
+ * other item showing the same image.
+ *
+ * Formats that cannot decode a sub-rectangle (everything but JPEG in practice)
+ * are decoded one whole level at a time instead.
+ *
+ * The image is drawn centered and scaled to fit the item, like an Image with
+ * fillMode set to Image.PreserveAspectFit. Nothing is drawn until tiles are
+ * available, so the item is meant to be stacked on top of a lower resolution
+ * version of the same image.
+ */
+class TiledImageItem : public QQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(QUrl source READ source WRITE setSource NOTIFY sourceChanged)
+    Q_PROPERTY(QSize sourceSize READ sourceSize NOTIFY sourceSizeChanged)
+    Q_PROPERTY(qreal zoom READ zoom WRITE setZoom NOTIFY zoomChanged)
+    Q_PROPERTY(QQuickItem *viewport READ viewport WRITE setViewport NOTIFY viewportChanged)
+    Q_PROPERTY(Status status READ status NOTIFY statusChanged)
+
+public:
+    /// Same values as Image.Status.
+    enum Status {
+        Null,
+        Ready,
+        Loading,
+        Error,
+    };
+    Q_ENUM(Status)
+
+    explicit TiledImageItem(QQuickItem *parent = nullptr);
+    ~TiledImageItem() override;
+
+    QUrl source() const;
+    void setSource(const QUrl &source);
+
+    /// The full resolution size of the image.
+    QSize sourceSize() const;
+
+    /**
+     * Scale applied to the item by its transforms, used to pick the level.
+     * Changing it also refreshes the visible tiles, which a transform alone
+     * does not.
+     */
+    qreal zoom() const;
+    void setZoom(qreal zoom);
+
+    /// Item clipping this one, only the tiles visible through it are loaded.
+    QQuickItem *viewport() const;
+    void setViewport(QQuickItem *viewport);
+
+    Status status() const;
+
+Q_SIGNALS:
+    void sourceChanged();
+    void sourceSizeChanged();
+    void zoomChanged();
+    void viewportChanged();
+    void statusChanged();
+
+protected:
+    void updatePolish() override;
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) override;
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void itemChange(ItemChange change, const ItemChangeData &value) override;
+
+private:
+    using CancelFlag = std::shared_ptr<std::atomic_bool>;
+
+    struct Tile {
+        QString key;
+        QRect sourceRect; // in full resolution pixels
+        QRectF rect; // in item coordinates
+        int level;
+    };
+
+    void setStatus(Status status);
+    void probe();
+    void probed(const QUrl &source, const QSize &size, bool supportsClipRect);
+    void tileLoaded(const QString &key);
+    void cancelAll();
+
+    QUrl m_source;
+    QSize m_sourceSize;
+    bool m_supportsClipRect = false;
+    qreal m_zoom = 1.0;
+    QPointer<QQuickItem> m_viewport;
+    Status m_status = Null;
+
+    QList<Tile> m_visibleTiles;
+    bool m_tilesChanged = false;
+    QHash<QString, CancelFlag> m_jobs; // tile key -> queued or running job
+};
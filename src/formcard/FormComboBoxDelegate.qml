@@ -9,6 +9,7 @@ import QtQuick.Layouts 1.15
 
 import org.kde.lingmoui 2.19 as LingmoUI
 import org.kde.lingmouiaddons.delegates as Delegates
+import org.kde.lingmouiaddons.formcard as FormCard
 
 /**
  * @brief A Form delegate that corresponds to a combobox.
@@ -200,6 +201,7 @@ AbstractFormDelegate {
         implicitWidth: ListView.view ? ListView.view.width : LingmoUI.Units.gridUnit * 16
         text: controlRoot.textRole ? (Array.isArray(controlRoot.model) ? modelData[controlRoot.textRole] : model[controlRoot.textRole]) : modelData
         checked: controlRoot.currentIndex === index
+        highlighted: ListView.isCurrentItem
 
         Layout.topMargin: index == 0 ? Math.round(LingmoUI.Units.smallSpacing / 2) : 0
 
@@ -262,18 +264,58 @@ AbstractFormDelegate {
         preferredWidth: LingmoUI.Units.gridUnit * 16
         parent: QQC2.Overlay.overlay
 
-        ColumnLayout {
+        onOpened: {
+            dialogView.currentIndex = -1;
+            dialogView.positionViewAtIndex(Math.max(controlRoot.currentIndex, 0), ListView.Contain);
+            if (dialogView.headerItem && dialogView.headerItem.visible) {
+                dialogView.headerItem.text = "";
+                dialogView.headerItem.forceActiveFocus();
+            }
+        }
+
+        // Only the visible options get a delegate, so that long lists open instantly.
+        ListView {
+            id: dialogView
+
+            implicitWidth: LingmoUI.Units.gridUnit * 16
+            implicitHeight: contentHeight
             spacing: 0
+            currentIndex: -1
+            reuseItems: true
+            model: controlRoot.model
+            delegate: controlRoot.dialogDelegate
 
-            Repeater {
-                model: controlRoot.model
-                delegate: controlRoot.dialogDelegate
+            // Type-ahead search, jumping to the first option starting with the typed text.
+            // It stays on top of the options while the list scrolls.
+            headerPositioning: ListView.OverlayHeader
+            header: QQC2.TextField {
+                z: 2
+                width: ListView.view.width
+                height: visible ? implicitHeight : 0
+                visible: controlRoot.count > controlRoot._searchThreshold
+                placeholderText: i18nd("lingmoui-addons6", "Search…")
+
+                onTextChanged: {
+                    const index = controlRoot._optionIndex.indexOfPrefix(text);
+                    dialogView.currentIndex = index;
+                    if (index >= 0) {
+                        dialogView.positionViewAtIndex(index, ListView.Contain);
+                    }
+                }
+                onAccepted: {
+                    if (dialogView.currentIndex >= 0) {
+                        const index = dialogView.currentIndex;
+                        controlRoot.currentIndex = index;
+                        controlRoot.activated(index);
+                        controlRoot.closeDialog();
+                    }
+                }
             }
 
-            QQC2.TextField {
+            footer: QQC2.TextField {
+                width: ListView.view.width
                 visible: controlRoot.editable
                 onTextChanged: controlRoot.editText = text;
-                Layout.fillWidth: true
             }
         }
     }
@@ -289,6 +331,7 @@ AbstractFormDelegate {
 
         ListView {
             spacing: 0
+            currentIndex: -1
             model: controlRoot.model
             delegate: controlRoot.dialogDelegate
 
@@ -301,7 +344,17 @@ AbstractFormDelegate {
     }
 
     function indexOfValue(value) {
-        return combobox.indexOfValue(value);
+        return _optionIndex.indexOfValue(value);
+    }
+
+    // Above this many options, the dialog shows a search field.
+    readonly property int _searchThreshold: 10
+
+    // Prefix search for the dialog, and indexOfValue() without going through every option.
+    readonly property FormCard.FormComboBoxIndex _optionIndex: FormCard.FormComboBoxIndex {
+        model: controlRoot.model
+        textRole: controlRoot.textRole
+        valueRole: controlRoot.valueRole
     }
 
     focusPolicy: Qt.StrongFocus
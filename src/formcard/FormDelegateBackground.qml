@@ -32,8 +32,10 @@ LingmoUI.ShadowedRectangle {
     required property T.Control control
 
     readonly property bool _roundCorners: control.parent._roundCorners === true
-    readonly property bool _isFirst: _roundCorners && control.parent.children[0] === control
-    readonly property bool _isLast: _roundCorners && control.parent.children[control.parent.children.length - 1] === control
+    // The rows of a VirtualFormCard are not all created, its view tells which ones are at the ends.
+    readonly property bool _inRowView: control.parent.firstRow !== undefined
+    readonly property bool _isFirst: _roundCorners && (_inRowView ? control.parent.firstRow === control : control.parent.children[0] === control)
+    readonly property bool _isLast: _roundCorners && (_inRowView ? control.parent.lastRow === control : control.parent.children[control.parent.children.length - 1] === control)
 
     color: {
         let colorOpacity = 0;
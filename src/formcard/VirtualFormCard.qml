@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: 2026 agent <agent@local>
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+import QtQuick
+import QtQuick.Layouts
+
+import org.kde.lingmoui as LingmoUI
+import org.kde.lingmouiaddons.formcard as FormCard
+
+/**
+ * @brief A FormCard that only creates the delegates close to the visible area.
+ *
+ * Instead of declaring the delegates as children, the rows are described by
+ * ::model, a list of objects whose keys are set on the properties of the same
+ * name of each delegate. Delegates are created from ::delegate, or from the
+ * component in the "delegate" key of their row, when they get close to the
+ * visible area of the page, and are reused for other rows once scrolled away.
+ * Separators are added between rows, unless the "separator" key of the row
+ * below is false.
+ *
+ * Use this instead of a FormCard for pages with hundreds of rows.
+ *
+ * @code
+ * FormCard.VirtualFormCard {
+ *     model: device.settings.map(setting => ({ text: setting.name, description: setting.value }))
+ *     delegate: FormCard.FormTextDelegate {}
+ * }
+ * @endcode
+ *
+ * Delegates can also declare `modelData` and `index` properties, to get the whole
+ * row description and its position.
+ *
+ * @since LingmoUIAddons 1.4.0
+ *
+ * @inherit FormCard
+ */
+FormCard.FormCard {
+    id: root
+
+    /**
+     * @brief The list of row descriptions.
+     */
+    property alias model: rowView.model
+
+    /**
+     * @brief The component used for rows that do not have their own "delegate" key.
+     */
+    property alias delegate: rowView.delegate
+
+    /**
+     * @brief The height assumed for rows until they are created.
+     *
+     * The closer it is to the real height of the rows, the steadier the scrollbar.
+     *
+     * default: `LingmoUI.Units.gridUnit * 3`
+     */
+    property alias estimatedRowHeight: rowView.estimatedRowHeight
+
+    /**
+     * @brief How far beyond the visible area rows are created, in pixels.
+     *
+     * default: `LingmoUI.Units.gridUnit * 10`
+     */
+    property alias cacheBuffer: rowView.cacheBuffer
+
+    /**
+     * @brief The number of rows.
+     */
+    readonly property alias count: rowView.count
+
+    /**
+     * @brief The delegate of the row at @p index, or null when it is not created.
+     */
+    function itemAt(index: int): Item {
+        return rowView.itemAt(index);
+    }
+
+    FormCard.FormCardRowView {
+        id: rowView
+
+        Layout.fillWidth: true
+
+        _roundCorners: parent._roundCorners === true
+        estimatedRowHeight: LingmoUI.Units.gridUnit * 3
+        cacheBuffer: LingmoUI.Units.gridUnit * 10
+        separatorMargins: LingmoUI.Units.largeSpacing
+        separator: Component {
+            FormCard.FormDelegateSeparator {}
+        }
+    }
+}
@@ -7,6 +7,9 @@
 #include <QQmlExtensionPlugin>
 #include <QQmlEngine>
 
+#include "formcardrowview.h"
+#include "formcomboboxindex.h"
+
 class FormCardPlugin : public QQmlExtensionPlugin
 {
     Q_OBJECT
@@ -19,6 +22,8 @@ public:
     {
         Q_ASSERT(QLatin1String(uri) == QLatin1String("org.kde.lingmouiaddons.formcard"));
         qmlRegisterModule(uri, 1, 0);
+        qmlRegisterType<FormCardRowView>(uri, 1, 0, "FormCardRowView");
+        qmlRegisterType<FormComboBoxIndex>(uri, 1, 0, "FormComboBoxIndex");
     }
 };
 
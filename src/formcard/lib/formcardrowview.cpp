@@ -0,0 +1,474 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "formcardrowview.h"
+
+#include <QDebug>
+#include <QQmlContext>
+#include <QQuickWindow>
+
+#include <limits>
+
+namespace
+{
+// Keys of a row description that are meant for the view, not for the row.
+const QString DelegateKey = QStringLiteral("delegate");
+const QString SeparatorKey = QStringLiteral("separator");
+
+bool hasProperty(const QObject *object, const QString &name)
+{
+    return object->metaObject()->indexOfProperty(name.toUtf8().constData()) >= 0;
+}
+}
+
+FormCardRowView::FormCardRowView(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+}
+
+FormCardRowView::~FormCardRowView() = default;
+
+QVariantList FormCardRowView::model() const
+{
+    return m_model;
+}
+
+void FormCardRowView::setModel(const QVariantList &model)
+{
+    if (m_model == model) {
+        return;
+    }
+
+    clear();
+    m_model = model;
+    m_rows.resize(m_model.size());
+    relayout();
+    Q_EMIT modelChanged();
+}
+
+QQmlComponent *FormCardRowView::delegate() const
+{
+    return m_delegate;
+}
+
+void FormCardRowView::setDelegate(QQmlComponent *delegate)
+{
+    if (m_delegate == delegate) {
+        return;
+    }
+
+    clear();
+    for (const auto &items : std::as_const(m_rowPool)) {
+        qDeleteAll(items);
+    }
+    m_rowPool.clear();
+    m_delegate = delegate;
+    relayout();
+    Q_EMIT delegateChanged();
+}
+
+QQmlComponent *FormCardRowView::separator() const
+{
+    return m_separator;
+}
+
+void FormCardRowView::setSeparator(QQmlComponent *separator)
+{
+    if (m_separator == separator) {
+        return;
+    }
+
+    clear();
+    qDeleteAll(m_separatorPool);
+    m_separatorPool.clear();
+    m_separator = separator;
+    relayout();
+    Q_EMIT separatorChanged();
+}
+
+qreal FormCardRowView::separatorMargins() const
+{
+    return m_separatorMargins;
+}
+
+void FormCardRowView::setSeparatorMargins(qreal separatorMargins)
+{
+    if (qFuzzyCompare(m_separatorMargins, separatorMargins)) {
+        return;
+    }
+    m_separatorMargins = separatorMargins;
+    relayout();
+    Q_EMIT separatorMarginsChanged();
+}
+
+qreal FormCardRowView::estimatedRowHeight() const
+{
+    return m_estimatedRowHeight;
+}
+
+void FormCardRowView::setEstimatedRowHeight(qreal estimatedRowHeight)
+{
+    if (qFuzzyCompare(m_estimatedRowHeight, estimatedRowHeight)) {
+        return;
+    }
+    m_estimatedRowHeight = estimatedRowHeight;
+    relayout();
+    Q_EMIT estimatedRowHeightChanged();
+}
+
+qreal FormCardRowView::cacheBuffer() const
+{
+    return m_cacheBuffer;
+}
+
+void FormCardRowView::setCacheBuffer(qreal cacheBuffer)
+{
+    if (qFuzzyCompare(m_cacheBuffer, cacheBuffer)) {
+        return;
+    }
+    m_cacheBuffer = cacheBuffer;
+    relayout();
+    Q_EMIT cacheBufferChanged();
+}
+
+int FormCardRowView::count() const
+{
+    return m_model.size();
+}
+
+bool FormCardRowView::roundCorners() const
+{
+    return m_roundCorners;
+}
+
+void FormCardRowView::setRoundCorners(bool roundCorners)
+{
+    if (m_roundCorners == roundCorners) {
+        return;
+    }
+    m_roundCorners = roundCorners;
+    Q_EMIT roundCornersChanged();
+}
+
+QQuickItem *FormCardRowView::firstRow() const
+{
+    return m_firstRow;
+}
+
+QQuickItem *FormCardRowView::lastRow() const
+{
+    return m_lastRow;
+}
+
+QQuickItem *FormCardRowView::itemAt(int index) const
+{
+    if (index < 0 || index >= int(m_rows.size())) {
+        return nullptr;
+    }
+    return m_rows[index].item;
+}
+
+void FormCardRowView::componentComplete()
+{
+    QQuickItem::componentComplete();
+    relayout();
+}
+
+void FormCardRowView::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry != oldGeometry) {
+        relayout();
+    }
+}
+
+void FormCardRowView::itemChange(ItemChange change, const ItemChangeData &value)
+{
+    QQuickItem::itemChange(change, value);
+    if (change == ItemParentHasChanged || change == ItemSceneChange) {
+        relayout();
+    }
+}
+
+void FormCardRowView::relayout()
+{
+    if (isComponentComplete()) {
+        polish();
+    }
+}
+
+void FormCardRowView::findFlickable()
+{
+    QQuickItem *flickable = parentItem();
+    while (flickable && !flickable->inherits("QQuickFlickable")) {
+        flickable = flickable->parentItem();
+    }
+    if (m_flickable == flickable) {
+        return;
+    }
+
+    if (m_flickable) {
+        disconnect(m_flickable, nullptr, this, nullptr);
+    }
+    m_flickable = flickable;
+
+    // Flickable is not public API, so its signals are connected by name.
+    if (m_flickable) {
+        connect(m_flickable, SIGNAL(contentYChanged()), this, SLOT(relayout()));
+        connect(m_flickable, SIGNAL(heightChanged()), this, SLOT(relayout()));
+        // Cards above this one changing size move it within the content.
+        connect(m_flickable, SIGNAL(contentHeightChanged()), this, SLOT(relayout()));
+    }
+}
+
+QRectF FormCardRowView::viewport() const
+{
+    if (m_flickable) {
+        return m_flickable->mapRectToItem(this, QRectF(0, 0, m_flickable->width(), m_flickable->height()));
+    }
+    if (window()) {
+        return mapRectFromScene(QRectF(0, 0, window()->width(), window()->height()));
+    }
+    // Nothing tells what is visible, so everything is.
+    return QRectF(0, 0, width(), std::numeric_limits<qreal>::max());
+}
+
+void FormCardRowView::updatePolish()
+{
+    if (m_layingOut) {
+        return;
+    }
+    m_layingOut = true;
+
+    findFlickable();
+    const QRectF viewport = this->viewport();
+    const qreal top = viewport.top() - m_cacheBuffer;
+    const qreal bottom = viewport.bottom() + m_cacheBuffer;
+
+    // Created rows may turn out taller or shorter than estimated, which moves the rows below.
+    // A few passes settle that, later frames fix whatever is left.
+    for (int pass = 0; pass < 3; ++pass) {
+        bool heightsChanged = false;
+        qreal y = 0;
+
+        for (int index = 0; index < int(m_rows.size()); ++index) {
+            Row &row = m_rows[index];
+            const qreal separatorHeight = hasSeparator(index) ? m_separatorHeight : 0;
+            const qreal rowHeight = row.height >= 0 ? row.height : m_estimatedRowHeight;
+            const bool visible = y + separatorHeight + rowHeight >= top && y <= bottom;
+
+            // The focused row stays, like the current item of a ListView.
+            if (!visible && !(row.item && row.item->hasActiveFocus())) {
+                releaseRow(index);
+                releaseSeparator(index);
+                y += separatorHeight + rowHeight;
+                continue;
+            }
+
+            if (separatorHeight > 0) {
+                if (!row.separator) {
+                    row.separator = createSeparator();
+                }
+                if (row.separator) {
+                    row.separator->setPosition(QPointF(m_separatorMargins, y));
+                    row.separator->setSize(QSizeF(width() - m_separatorMargins * 2, separatorHeight));
+                }
+                y += separatorHeight;
+            }
+
+            if (!row.item) {
+                row.item = createRow(index);
+            }
+            if (row.item) {
+                const qreal height = row.item->implicitHeight();
+                heightsChanged = heightsChanged || !qFuzzyCompare(height + 1, rowHeight + 1);
+                row.height = height;
+                row.item->setPosition(QPointF(0, y));
+                row.item->setSize(QSizeF(width(), height));
+            }
+            y += row.height >= 0 ? row.height : m_estimatedRowHeight;
+
+            if (row.separator) {
+                if (hasProperty(row.separator, QStringLiteral("above"))) {
+                    row.separator->setProperty("above", QVariant::fromValue(index > 0 ? m_rows[index - 1].item : nullptr));
+                }
+                if (hasProperty(row.separator, QStringLiteral("below"))) {
+                    row.separator->setProperty("below", QVariant::fromValue(row.item));
+                }
+            }
+        }
+
+        setImplicitHeight(y);
+        if (!heightsChanged) {
+            break;
+        }
+    }
+
+    updateEnds();
+    m_layingOut = false;
+}
+
+QQmlComponent *FormCardRowView::componentFor(int index) const
+{
+    const QVariant delegate = m_model.at(index).toMap().value(DelegateKey);
+    if (auto component = qobject_cast<QQmlComponent *>(delegate.value<QObject *>())) {
+        return component;
+    }
+    return m_delegate;
+}
+
+QString FormCardRowView::poolKey(int index) const
+{
+    // A pooled row only gets the keys of its new description, so it must have the same ones.
+    QStringList keys = m_model.at(index).toMap().keys();
+    keys.prepend(QString::number(quintptr(componentFor(index)), 16));
+    return keys.join(QLatin1Char('/'));
+}
+
+QVariantMap FormCardRowView::propertiesFor(int index) const
+{
+    QVariantMap properties = m_model.at(index).toMap();
+    properties.remove(DelegateKey);
+    properties.remove(SeparatorKey);
+    properties.insert(QStringLiteral("modelData"), m_model.at(index));
+    properties.insert(QStringLiteral("index"), index);
+    return properties;
+}
+
+bool FormCardRowView::hasSeparator(int index) const
+{
+    return index > 0 && m_separator && m_model.at(index).toMap().value(SeparatorKey, true).toBool();
+}
+
+QQuickItem *FormCardRowView::createRow(int index)
+{
+    Row &row = m_rows[index];
+    row.poolKey = poolKey(index);
+
+    QList<QQuickItem *> &pool = m_rowPool[row.poolKey];
+    if (!pool.isEmpty()) {
+        QQuickItem *item = pool.takeLast();
+        const QVariantMap properties = propertiesFor(index);
+        for (auto it = properties.cbegin(); it != properties.cend(); ++it) {
+            if (hasProperty(item, it.key())) {
+                item->setProperty(it.key().toUtf8().constData(), it.value());
+            }
+        }
+        item->setVisible(true);
+        return item;
+    }
+
+    QQmlComponent *component = componentFor(index);
+    if (!component) {
+        return nullptr;
+    }
+    auto item = qobject_cast<QQuickItem *>(create(component, propertiesFor(index)));
+    if (item) {
+        connect(item, &QQuickItem::implicitHeightChanged, this, &FormCardRowView::relayout);
+    }
+    return item;
+}
+
+void FormCardRowView::releaseRow(int index)
+{
+    Row &row = m_rows[index];
+    if (!row.item) {
+        return;
+    }
+    row.item->setVisible(false);
+    m_rowPool[row.poolKey].append(row.item);
+    row.item = nullptr;
+}
+
+QQuickItem *FormCardRowView::createSeparator()
+{
+    if (!m_separatorPool.isEmpty()) {
+        QQuickItem *separator = m_separatorPool.takeLast();
+        separator->setVisible(true);
+        return separator;
+    }
+
+    if (!m_separator) {
+        return nullptr;
+    }
+    auto separator = qobject_cast<QQuickItem *>(create(m_separator, {}));
+    if (separator && separator->implicitHeight() > 0) {
+        m_separatorHeight = separator->implicitHeight();
+    }
+    return separator;
+}
+
+void FormCardRowView::releaseSeparator(int index)
+{
+    Row &row = m_rows[index];
+    if (!row.separator) {
+        return;
+    }
+    row.separator->setVisible(false);
+    m_separatorPool.append(row.separator);
+    row.separator = nullptr;
+}
+
+QObject *FormCardRowView::create(QQmlComponent *component, const QVariantMap &properties)
+{
+    QQmlContext *context = component->creationContext();
+    if (!context) {
+        context = qmlContext(this);
+    }
+
+    QObject *object = component->beginCreate(context);
+    if (!object) {
+        qWarning() << "FormCardRowView: could not create a row:" << component->errors();
+        return nullptr;
+    }
+
+    QVariantMap initialProperties;
+    for (auto it = properties.cbegin(); it != properties.cend(); ++it) {
+        if (hasProperty(object, it.key())) {
+            initialProperties.insert(it.key(), it.value());
+        }
+    }
+    component->setInitialProperties(object, initialProperties);
+
+    object->setParent(this);
+    if (auto item = qobject_cast<QQuickItem *>(object)) {
+        item->setParentItem(this);
+    }
+    component->completeCreate();
+
+    if (!qobject_cast<QQuickItem *>(object)) {
+        qWarning() << "FormCardRowView: rows and separators must be items";
+        delete object;
+        return nullptr;
+    }
+    return object;
+}
+
+void FormCardRowView::clear()
+{
+    for (int index = 0; index < int(m_rows.size()); ++index) {
+        releaseRow(index);
+        releaseSeparator(index);
+    }
+    m_rows.clear();
+    updateEnds();
+}
+
+void FormCardRowView::updateEnds()
+{
+    QQuickItem *first = m_rows.empty() ? nullptr : m_rows.front().item;
+    QQuickItem *last = m_rows.empty() ? nullptr : m_rows.back().item;
+    if (m_firstRow != first) {
+        m_firstRow = first;
+        Q_EMIT firstRowChanged();
+    }
+    if (m_lastRow != last) {
+        m_lastRow = last;
+        Q_EMIT lastRowChanged();
+    }
+}
+
+#include "moc_formcardrowview.cpp"
@@ -0,0 +1,168 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QHash>
+#include <QPointer>
+#include <QQmlComponent>
+#include <QQuickItem>
+
+#include <vector>
+
+/**
+ * @brief A column of form rows that only creates the rows close to the visible area.
+ *
+ * Each entry of model describes a row. Its keys are set on the properties of
+ * the same name of the row, which also gets the whole entry as modelData and
+ * its position as index when it has such properties. A row is created from
+ * the delegate of the view, or from the component given by its own "delegate"
+ * key, and gets a separator above it unless its "separator" key is false.
+ *
+ * Rows and separators that scroll away from the nearest Flickable are kept
+ * for rows using the same component and keys. Rows that were never created
+ * count as estimatedRowHeight until they are.
+ *
+ * @see VirtualFormCard
+ */
+class FormCardRowView : public QQuickItem
+{
+    Q_OBJECT
+
+    /**
+     * @brief The list of row descriptions.
+     */
+    Q_PROPERTY(QVariantList model READ model WRITE setModel NOTIFY modelChanged)
+
+    /**
+     * @brief The component used for rows that do not have their own.
+     */
+    Q_PROPERTY(QQmlComponent *delegate READ delegate WRITE setDelegate NOTIFY delegateChanged)
+
+    /**
+     * @brief The component put between two rows, given the above and below rows when it has such properties.
+     */
+    Q_PROPERTY(QQmlComponent *separator READ separator WRITE setSeparator NOTIFY separatorChanged)
+
+    /**
+     * @brief The space left on each side of the separators.
+     */
+    Q_PROPERTY(qreal separatorMargins READ separatorMargins WRITE setSeparatorMargins NOTIFY separatorMarginsChanged)
+
+    /**
+     * @brief The height assumed for rows that were not created yet, default 48.
+     */
+    Q_PROPERTY(qreal estimatedRowHeight READ estimatedRowHeight WRITE setEstimatedRowHeight NOTIFY estimatedRowHeightChanged)
+
+    /**
+     * @brief How far beyond the visible area rows are created, default 320.
+     */
+    Q_PROPERTY(qreal cacheBuffer READ cacheBuffer WRITE setCacheBuffer NOTIFY cacheBufferChanged)
+
+    Q_PROPERTY(int count READ count NOTIFY modelChanged)
+
+    /**
+     * @brief Used by FormDelegateBackground, to round the corners of the first and last rows.
+     */
+    Q_PROPERTY(bool _roundCorners READ roundCorners WRITE setRoundCorners NOTIFY roundCornersChanged)
+    Q_PROPERTY(QQuickItem *firstRow READ firstRow NOTIFY firstRowChanged)
+    Q_PROPERTY(QQuickItem *lastRow READ lastRow NOTIFY lastRowChanged)
+
+public:
+    explicit FormCardRowView(QQuickItem *parent = nullptr);
+    ~FormCardRowView() override;
+
+    QVariantList model() const;
+    void setModel(const QVariantList &model);
+
+    QQmlComponent *delegate() const;
+    void setDelegate(QQmlComponent *delegate);
+
+    QQmlComponent *separator() const;
+    void setSeparator(QQmlComponent *separator);
+
+    qreal separatorMargins() const;
+    void setSeparatorMargins(qreal separatorMargins);
+
+    qreal estimatedRowHeight() const;
+    void setEstimatedRowHeight(qreal estimatedRowHeight);
+
+    qreal cacheBuffer() const;
+    void setCacheBuffer(qreal cacheBuffer);
+
+    int count() const;
+
+    bool roundCorners() const;
+    void setRoundCorners(bool roundCorners);
+
+    QQuickItem *firstRow() const;
+    QQuickItem *lastRow() const;
+
+    /**
+     * @brief The row item at @p index, or null when it is not created.
+     */
+    Q_INVOKABLE QQuickItem *itemAt(int index) const;
+
+Q_SIGNALS:
+    void modelChanged();
+    void delegateChanged();
+    void separatorChanged();
+    void separatorMarginsChanged();
+    void estimatedRowHeightChanged();
+    void cacheBufferChanged();
+    void roundCornersChanged();
+    void firstRowChanged();
+    void lastRowChanged();
+
+protected:
+    void componentComplete() override;
+    void updatePolish() override;
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void itemChange(ItemChange change, const ItemChangeData &value) override;
+
+private Q_SLOTS:
+    void relayout();
+
+private:
+    struct Row {
+        QQuickItem *item = nullptr;
+        QQuickItem *separator = nullptr; // above the row
+        qreal height = -1; // -1 until the row was created once
+        QString poolKey; // of the item, to pool it again once hidden
+    };
+
+    QQmlComponent *componentFor(int index) const;
+    QString poolKey(int index) const;
+    QVariantMap propertiesFor(int index) const;
+    bool hasSeparator(int index) const;
+    QRectF viewport() const;
+    void findFlickable();
+
+    QQuickItem *createRow(int index);
+    void releaseRow(int index);
+    QQuickItem *createSeparator();
+    void releaseSeparator(int index);
+    QObject *create(QQmlComponent *component, const QVariantMap &properties);
+    void clear();
+    void updateEnds();
+
+    QVariantList m_model;
+    QPointer<QQmlComponent> m_delegate;
+    QPointer<QQmlComponent> m_separator;
+    qreal m_separatorMargins = 0;
+    qreal m_estimatedRowHeight = 48;
+    qreal m_separatorHeight = 1; // measured on the first separator
+    qreal m_cacheBuffer = 320;
+    bool m_roundCorners = false;
+
+    std::vector<Row> m_rows;
+    QHash<QString, QList<QQuickItem *>> m_rowPool; // hidden rows, by component and keys
+    QList<QQuickItem *> m_separatorPool;
+    QPointer<QQuickItem> m_flickable;
+    QPointer<QQuickItem> m_firstRow;
+    QPointer<QQuickItem> m_lastRow;
+    bool m_layingOut = false;
+};
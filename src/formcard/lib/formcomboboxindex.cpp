@@ -0,0 +1,213 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "formcomboboxindex.h"
+
+#include <QJSValue>
+
+#include <algorithm>
+
+FormComboBoxIndex::FormComboBoxIndex(QObject *parent)
+    : QObject(parent)
+{
+}
+
+QVariant FormComboBoxIndex::model() const
+{
+    return m_model;
+}
+
+void FormComboBoxIndex::setModel(const QVariant &value)
+{
+    // JavaScript arrays may come wrapped, the index only deals with plain lists.
+    const QVariant model = value.metaType() == QMetaType::fromType<QJSValue>() ? value.value<QJSValue>().toVariant() : value;
+    if (m_model == model) {
+        return;
+    }
+
+    if (m_itemModel) {
+        disconnect(m_itemModel, nullptr, this, nullptr);
+    }
+    m_model = model;
+    m_itemModel = qobject_cast<QAbstractItemModel *>(model.value<QObject *>());
+
+    if (m_itemModel) {
+        connect(m_itemModel, &QAbstractItemModel::modelReset, this, &FormComboBoxIndex::invalidate);
+        connect(m_itemModel, &QAbstractItemModel::layoutChanged, this, &FormComboBoxIndex::invalidate);
+        connect(m_itemModel, &QAbstractItemModel::rowsInserted, this, &FormComboBoxIndex::invalidate);
+        connect(m_itemModel, &QAbstractItemModel::rowsRemoved, this, &FormComboBoxIndex::invalidate);
+        connect(m_itemModel, &QAbstractItemModel::rowsMoved, this, &FormComboBoxIndex::invalidate);
+        connect(m_itemModel, &QAbstractItemModel::dataChanged, this, &FormComboBoxIndex::invalidate);
+    }
+
+    invalidate();
+    Q_EMIT modelChanged();
+}
+
+QString FormComboBoxIndex::textRole() const
+{
+    return m_textRole;
+}
+
+void FormComboBoxIndex::setTextRole(const QString &textRole)
+{
+    if (m_textRole == textRole) {
+        return;
+    }
+    m_textRole = textRole;
+    invalidate();
+    Q_EMIT textRoleChanged();
+}
+
+QString FormComboBoxIndex::valueRole() const
+{
+    return m_valueRole;
+}
+
+void FormComboBoxIndex::setValueRole(const QString &valueRole)
+{
+    if (m_valueRole == valueRole) {
+        return;
+    }
+    m_valueRole = valueRole;
+    invalidate();
+    Q_EMIT valueRoleChanged();
+}
+
+int FormComboBoxIndex::indexOfPrefix(const QString &prefix, int from)
+{
+    build();
+    if (prefix.isEmpty() || m_texts.empty()) {
+        return -1;
+    }
+
+    // All the texts starting with the prefix are next to each other in sorted order.
+    const QString folded = prefix.toCaseFolded();
+    const auto first = std::lower_bound(m_texts.cbegin(), m_texts.cend(), folded, [](const std::pair<QString, int> &entry, const QString &prefix) {
+        return entry.first < prefix;
+    });
+    auto last = first;
+    while (last != m_texts.cend() && last->first.startsWith(folded)) {
+        ++last;
+    }
+    if (first == last) {
+        return -1;
+    }
+
+    int wrapped = -1;
+    int next = -1;
+    for (auto it = first; it != last; ++it) {
+        const int index = it->second;
+        if (index >= from && (next < 0 || index < next)) {
+            next = index;
+        }
+        if (wrapped < 0 || index < wrapped) {
+            wrapped = index;
+        }
+    }
+    return next >= 0 ? next : wrapped;
+}
+
+int FormComboBoxIndex::indexOfValue(const QVariant &value)
+{
+    build();
+
+    const auto it = m_valueIndexes.constFind(value.toString());
+    if (it != m_valueIndexes.cend() && m_values.at(*it) == value) {
+        return *it;
+    }
+
+    // Values with the same string but different types, like 1 and "1", share a key.
+    for (int index = 0; index < m_values.size(); ++index) {
+        if (m_values.at(index) == value) {
+            return index;
+        }
+    }
+    return -1;
+}
+
+void FormComboBoxIndex::invalidate()
+{
+    m_dirty = true;
+}
+
+int FormComboBoxIndex::optionCount() const
+{
+    if (m_itemModel) {
+        return m_itemModel->rowCount();
+    }
+    if (m_model.canConvert<QVariantList>() && m_model.typeId() != QMetaType::QString) {
+        return m_model.toList().size();
+    }
+    // A plain number of options, like ComboBox accepts.
+    return m_model.typeId() == QMetaType::Int || m_model.typeId() == QMetaType::Double ? std::max(m_model.toInt(), 0) : 0;
+}
+
+QVariant FormComboBoxIndex::optionData(int index, int role) const
+{
+    if (m_itemModel) {
+        return m_itemModel->index(index, 0).data(role);
+    }
+    // The options of a numeric model are their own indexes.
+    return index;
+}
+
+void FormComboBoxIndex::build()
+{
+    if (!m_dirty) {
+        return;
+    }
+    m_dirty = false;
+
+    m_texts.clear();
+    m_values.clear();
+    m_valueIndexes.clear();
+
+    int textRole = Qt::DisplayRole;
+    int valueRole = Qt::DisplayRole;
+    if (m_itemModel) {
+        const auto roles = m_itemModel->roleNames();
+        textRole = m_textRole.isEmpty() ? Qt::DisplayRole : roles.key(m_textRole.toUtf8(), Qt::DisplayRole);
+        valueRole = m_valueRole.isEmpty() ? textRole : roles.key(m_valueRole.toUtf8(), textRole);
+    }
+
+    // Converting a JavaScript array is not free, so it is done once here.
+    const QVariantList list = m_itemModel ? QVariantList() : m_model.toList();
+    const int count = list.isEmpty() ? optionCount() : int(list.size());
+    m_texts.reserve(count);
+    m_values.reserve(count);
+
+    for (int index = 0; index < count; ++index) {
+        QVariant text;
+        QVariant value;
+        if (!m_itemModel && !list.isEmpty()) {
+            const QVariant &entry = list.at(index);
+            const auto object = entry.value<QObject *>();
+            const auto field = [&entry, object](const QString &role) {
+                if (role.isEmpty()) {
+                    return entry;
+                }
+                return object ? object->property(role.toUtf8().constData()) : entry.toMap().value(role);
+            };
+            text = field(m_textRole);
+            value = m_valueRole.isEmpty() ? text : field(m_valueRole);
+        } else {
+            text = optionData(index, textRole);
+            value = m_valueRole.isEmpty() ? text : optionData(index, valueRole);
+        }
+
+        m_texts.emplace_back(text.toString().toCaseFolded(), index);
+        m_values.append(value);
+        const QString key = value.toString();
+        if (!m_valueIndexes.contains(key)) {
+            m_valueIndexes.insert(key, index);
+        }
+    }
+
+    std::sort(m_texts.begin(), m_texts.end());
+}
+
+#include "moc_formcomboboxindex.cpp"
@@ -0,0 +1,79 @@
+/*
+ *   SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *   SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QAbstractItemModel>
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QVariant>
+
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Looks up the options of a FormComboBoxDelegate by text prefix and by value.
+ *
+ * Takes the same models as a ComboBox: a QAbstractItemModel, a JavaScript
+ * array of strings or objects, or a number of entries. The texts and values
+ * are read once, on the first lookup after the model changed, into a list of
+ * case folded texts sorted for prefix searches and a hash of the values.
+ */
+class FormComboBoxIndex : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QVariant model READ model WRITE setModel NOTIFY modelChanged)
+    Q_PROPERTY(QString textRole READ textRole WRITE setTextRole NOTIFY textRoleChanged)
+    Q_PROPERTY(QString valueRole READ valueRole WRITE setValueRole NOTIFY valueRoleChanged)
+
+public:
+    explicit FormComboBoxIndex(QObject *parent = nullptr);
+
+    QVariant model() const;
+    void setModel(const QVariant &model);
+
+    QString textRole() const;
+    void setTextRole(const QString &textRole);
+
+    QString valueRole() const;
+    void setValueRole(const QString &valueRole);
+
+    /**
+     * @brief The first option at or after @p from whose text starts with @p prefix, ignoring case, or -1.
+     *
+     * The search wraps around to the first option, so that typing the same
+     * letter again goes through the matching options.
+     */
+    Q_INVOKABLE int indexOfPrefix(const QString &prefix, int from = 0);
+
+    /**
+     * @brief The index of the first option with the value @p value, or -1, like ComboBox.indexOfValue().
+     */
+    Q_INVOKABLE int indexOfValue(const QVariant &value);
+
+Q_SIGNALS:
+    void modelChanged();
+    void textRoleChanged();
+    void valueRoleChanged();
+
+private:
+    void invalidate();
+    void build();
+    int optionCount() const;
+    QVariant optionData(int index, int role) const;
+
+    QVariant m_model;
+    QPointer<QAbstractItemModel> m_itemModel;
+    QString m_textRole;
+    QString m_valueRole;
+
+    bool m_dirty = true;
+    std::vector<std::pair<QString, int>> m_texts; // case folded text and option index, sorted
+    QList<QVariant> m_values; // by option index
+    QHash<QString, int> m_valueIndexes; // first option index by value, as a string
+};
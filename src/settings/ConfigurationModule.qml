@@ -66,4 +66,22 @@ QtObject {
      * be grouped in the default category.
      */
     property string category: "_main_category"
+
+    /**
+     * This property holds additional words matched by the search field of the
+     * configuration view, typically the labels of the settings in the page.
+     *
+     * Searching does not create the pages of the modules, so the settings of
+     * a page can only be found through its keywords.
+     *
+     * @code{qml}
+     * keywords: [
+     *     i18nc("@label", "Font size"),
+     *     i18nc("@label", "Color scheme")
+     * ]
+     * @endcode
+     *
+     * @since LingmoUIAddons 1.4.0
+     */
+    property list<string> keywords
 }
@@ -92,6 +92,35 @@ QtObject {
      */
     property LingmoUI.ApplicationWindow window
 
+    /**
+     * @brief This property holds how many pages are kept once created.
+     *
+     * The pages of the modules are created the first time they are opened,
+     * and kept for the next times, even after the configuration view is closed.
+     * Only the most recently used pages are kept, to bound memory usage.
+     *
+     * default: `5`
+     *
+     * @since LingmoUIAddons 1.4.0
+     */
+    property int cachedPages: 5
+
+    /**
+     * @brief This signal is emitted when the page of the module @p moduleId is created.
+     *
+     * @p elapsed holds how long the creation took, in milliseconds. @p preloaded
+     * is true for pages created ahead of time, between frames, because their
+     * module was likely to be opened next.
+     *
+     * @since LingmoUIAddons 1.4.0
+     */
+    signal pageCreated(string moduleId, int elapsed, bool preloaded)
+
+    readonly property Private.ConfigurationPageCache __pageCache: Private.ConfigurationPageCache {
+        maximumPages: root.cachedPages
+        onPageCreated: (moduleId, elapsed, preloaded) => root.pageCreated(moduleId, elapsed, preloaded)
+    }
+
     /**
      * Open the configuration window.
      * @params defaultModule The moduleId of the default configuration that should be preselected when opening the configuration view. By default is not specified, this will choose the first module.
@@ -106,6 +135,7 @@ QtObject {
             root.window.pageStack.layers.push(component, {
                 defaultModule: defaultModule,
                 modules: root.modules,
+                pageCache: root.__pageCache,
                 title: root.title,
                 window: root.window,
             })
@@ -118,6 +148,7 @@ QtObject {
             component.createObject(null, {
                 defaultModule: defaultModule,
                 modules: root.modules,
+                pageCache: root.__pageCache,
                 width: LingmoUI.Units.gridUnit * 50,
                 height: LingmoUI.Units.gridUnit * 30,
                 minimumWidth: LingmoUI.Units.gridUnit * 50,
@@ -10,6 +10,7 @@ import QtQuick.Controls as Controls
 import org.kde.lingmoui as LingmoUI
 import org.kde.lingmouiaddons.formcard as FormCard
 import org.kde.lingmouiaddons.settings
+import org.kde.lingmouiaddons.settings.private as Private
 
 FormCard.FormCardPage {
     id: root
@@ -17,12 +18,22 @@ FormCard.FormCardPage {
     required property string defaultModule
     required property list<ConfigurationModule> modules
     required property LingmoUI.ApplicationWindow window
+    required property Private.ConfigurationPageCache pageCache
 
-    // Do not use Map, it crashes very frequently
-    property var pageCache: Object.create(null)
+    readonly property Private.SettingsSearchIndex searchIndex: Private.SettingsSearchIndex {
+        modules: root.modules
+    }
 
     title: i18ndc("lingmoui-addons6", "@title", "Settings")
 
+    // Most of the time, the first module is the one opened.
+    Component.onCompleted: {
+        const module = getModuleByName(defaultModule) ?? modules.find(module => module.visible);
+        if (module) {
+            pageCache.preload(module);
+        }
+    }
+
     // search bar
     FormCard.FormCard {
         Layout.fillWidth: true
@@ -39,7 +50,7 @@ FormCard.FormCardPage {
                 id: searchField
                 Layout.fillWidth: true
                 autoAccept: true
-                onTextChanged: repeater.filterText = text.toLowerCase();
+                onTextChanged: repeater.filterText = text;
                 background: null
             }
         }
@@ -51,13 +62,14 @@ FormCard.FormCardPage {
         property string filterText: ""
 
         model: {
-            const isFiltering = filterText.length !== 0;
+            // Searched again when the text of a module changes.
+            void root.searchIndex.revision;
+            const matching = root.searchIndex.search(filterText);
             let filteredCategories = new Array();
 
-            for (let i in root.modules) {
-                const module = modules[i];
-                const modulePassesFilter = module.text.toLowerCase().includes(filterText);
-                if (module.visible && (isFiltering ? modulePassesFilter : true)) {
+            for (const index of matching) {
+                const module = root.modules[index];
+                if (module.visible) {
                     const category = filteredCategories.find((category) => category.name === module.category);
                     if (category) {
                         category.modules.push(module);
@@ -108,6 +120,7 @@ FormCard.FormCardPage {
 
                             onClicked: {
                                 root.window.pageStack.layers.push(pageForModule(modelData));
+                                root.preloadNeighbours(modelData);
                             }
 
                             contentItem: RowLayout {
@@ -139,20 +152,18 @@ FormCard.FormCardPage {
         }
     }
 
-    function pageForModule(module: ConfigurationModule) {
-        if (pageCache[module.moduleId]) {
-            return pageCache[module.moduleId];
-        } else {
-            const component = module.page();
-            if (component.status === Component.Error) {
-                console.error(component.errorString());
-            }
-            const page = component.createObject(root, module.initialProperties());
-            if (page.title.length === 0) {
-                page.title = module.text;
+    function pageForModule(module: ConfigurationModule): var {
+        return pageCache.page(module);
+    }
+
+    // The modules next to the opened one are the most likely to be opened next.
+    function preloadNeighbours(module: ConfigurationModule): void {
+        const visibleModules = modules.filter(module => module.visible);
+        const index = visibleModules.indexOf(module);
+        for (const neighbour of [visibleModules[index + 1], visibleModules[index - 1]]) {
+            if (neighbour) {
+                pageCache.preload(neighbour);
             }
-            pageCache[module.moduleId] = page;
-            return page;
         }
     }
 
@@ -11,15 +11,18 @@ import QtQuick.Layouts
 import org.kde.lingmoui as LingmoUI
 import org.kde.lingmouiaddons.delegates as Delegates
 import org.kde.lingmouiaddons.settings
+import org.kde.lingmouiaddons.settings.private as Private
 
 LingmoUI.ApplicationWindow {
     id: root
 
     required property string defaultModule
     required property list<ConfigurationModule> modules
+    required property Private.ConfigurationPageCache pageCache
 
-    // Do not use Map, it crashes very frequently
-    property var pageCache: Object.create(null)
+    readonly property Private.SettingsSearchIndex searchIndex: Private.SettingsSearchIndex {
+        modules: root.modules
+    }
 
     pageStack {
         columnView.columnWidth: LingmoUI.Units.gridUnit * 13
@@ -34,6 +37,9 @@ LingmoUI.ApplicationWindow {
 
     contentItem.Keys.onEscapePressed: root.close()
 
+    // Hand the cached pages back, so that the next configuration window can show them.
+    onClosing: pageStack.clear()
+
     globalDrawer: LingmoUI.OverlayDrawer {
         id: drawer
         edge: Qt.application.layoutDirection === Qt.RightToLeft ? Qt.RightEdge : Qt.LeftEdge
@@ -67,7 +73,12 @@ LingmoUI.ApplicationWindow {
 
                 contentItem: LingmoUI.SearchField {
                     Layout.fillWidth: true
-                    onTextChanged: listview.filterText = text.toLowerCase();
+                    autoAccept: false
+                    onTextChanged: listview.filterText = text;
+                    // Only the page of the first match gets created.
+                    onAccepted: if (listview.count > 0) {
+                        listview.itemAtIndex(0).clicked();
+                    }
                 }
             }
 
@@ -89,20 +100,21 @@ LingmoUI.ApplicationWindow {
                             root.pageStack.push(pageForModule(module));
                             listview.currentIndex = modules.findIndex(module => module.moduleId == defaultModule);
                         } else {
-                            root.pageStack.push(pageForModule(modules[0]));
+                            module = modules[0];
+                            root.pageStack.push(pageForModule(module));
                             listview.currentIndex = 0;
-                            if (root.pageStack.currentItem.title.length === 0) {
-                                root.pageStack.currentItem.title = modules[0].text;
-                            }
                         }
+                        root.preloadNeighbours(module);
                         initDone = true;
                     }
                     model: {
-                        const isFiltering = filterText.length !== 0;
+                        // Searched again when the text of a module changes.
+                        void root.searchIndex.revision;
+                        const matching = root.searchIndex.search(filterText);
                         let filteredModules = [];
-                        for (const module of root.modules) {
-                            const modulePassesFilter = module.text.toLowerCase().includes(filterText);
-                            if (module.visible && (isFiltering ? modulePassesFilter : true)) {
+                        for (const index of matching) {
+                            const module = root.modules[index];
+                            if (module.visible) {
                                 filteredModules.push(module);
                             }
                         }
@@ -127,9 +139,7 @@ LingmoUI.ApplicationWindow {
                             root.pageStack.replace(page);
 
                             ListView.view.currentIndex = settingDelegate.index;
-                            if (root.pageStack.currentItem.title.length === 0) {
-                                root.pageStack.currentItem.title = text;
-                            }
+                            root.preloadNeighbours(modelData);
                         }
                     }
                 }
@@ -138,26 +148,17 @@ LingmoUI.ApplicationWindow {
     }
 
     function pageForModule(module: ConfigurationModule): var {
-        if (pageCache[module.moduleId]) {
-            return pageCache[module.moduleId];
-        } else {
-            const component = module.page();
-            if (!component) {
-                console.error("Unable to create component for moduleId", module.moduleId);
-                return null;
-            }
-
-            if (component.status === Component.Error) {
-                console.error(`Unable to create component for moduleId: "${module.moduleId}". Error: ${component.errorString()}`);
-                return null;
-            }
+        return pageCache.page(module);
+    }
 
-            const page = component.createObject(root, module.initialProperties());
-            if (page.title.length === 0) {
-                page.title = module.text;
+    // The modules next to the opened one are the most likely to be opened next.
+    function preloadNeighbours(module: ConfigurationModule): void {
+        const visibleModules = modules.filter(module => module.visible);
+        const index = visibleModules.indexOf(module);
+        for (const neighbour of [visibleModules[index + 1], visibleModules[index - 1]]) {
+            if (neighbour) {
+                pageCache.preload(neighbour);
             }
-            pageCache[module.moduleId] = page;
-            return page;
         }
     }
 
@@ -0,0 +1,243 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "configurationpagecache.h"
+#include "settingsdebug.h"
+
+#include <QJSValue>
+#include <QQmlComponent>
+#include <QQmlEngine>
+#include <QQmlIncubator>
+#include <QQuickItem>
+
+#include <algorithm>
+
+using namespace Qt::StringLiterals;
+
+class ConfigurationPageCache::Incubator : public QQmlIncubator
+{
+public:
+    Incubator(ConfigurationPageCache *cache, QObject *module, bool preloaded)
+        : QQmlIncubator(preloaded ? QQmlIncubator::Asynchronous : QQmlIncubator::Synchronous)
+        , cache(cache)
+        , module(module)
+        , moduleId(module->property("moduleId").toString())
+        , preloaded(preloaded)
+    {
+        timer.start();
+    }
+
+    QPointer<ConfigurationPageCache> cache;
+    QPointer<QObject> module;
+    const QString moduleId;
+    const bool preloaded;
+    bool opened = false; // asked for by page() while preloading
+    QElapsedTimer timer;
+
+protected:
+    void statusChanged(Status status) override
+    {
+        if (status != Ready && status != Error) {
+            return;
+        }
+        // The incubator must not be destroyed from its own callback.
+        QMetaObject::invokeMethod(
+            cache,
+            [cache = cache, moduleId = moduleId] {
+                if (cache) {
+                    if (const auto incubator = cache->m_incubators.value(moduleId)) {
+                        cache->incubatorFinished(incubator.get());
+                    }
+                }
+            },
+            Qt::QueuedConnection);
+    }
+};
+
+ConfigurationPageCache::ConfigurationPageCache(QObject *parent)
+    : QObject(parent)
+{
+}
+
+ConfigurationPageCache::~ConfigurationPageCache()
+{
+    for (const auto &incubator : std::as_const(m_incubators)) {
+        incubator->clear();
+    }
+}
+
+int ConfigurationPageCache::maximumPages() const
+{
+    return m_maximumPages;
+}
+
+void ConfigurationPageCache::setMaximumPages(int maximumPages)
+{
+    maximumPages = std::max(maximumPages, 1);
+    if (m_maximumPages == maximumPages) {
+        return;
+    }
+    m_maximumPages = maximumPages;
+    evict();
+    Q_EMIT maximumPagesChanged();
+}
+
+QObject *ConfigurationPageCache::page(QObject *module)
+{
+    if (!module) {
+        return nullptr;
+    }
+
+    const QString moduleId = module->property("moduleId").toString();
+    if (const auto page = m_pages.value(moduleId)) {
+        touch(moduleId);
+        return page;
+    }
+
+    if (!m_incubators.contains(moduleId)) {
+        incubate(module, false);
+    }
+    // Finish a preloading page right away, the user is waiting for it.
+    if (const auto incubator = m_incubators.value(moduleId)) {
+        incubator->opened = true;
+        if (incubator->isLoading()) {
+            incubator->forceCompletion();
+        }
+        incubatorFinished(incubator.get());
+    }
+    return m_pages.value(moduleId);
+}
+
+void ConfigurationPageCache::preload(QObject *module)
+{
+    if (!module || contains(module)) {
+        return;
+    }
+    // It would be evicted as soon as created.
+    if (openedPageCount() >= m_maximumPages) {
+        return;
+    }
+    const QString moduleId = module->property("moduleId").toString();
+    if (!m_incubators.contains(moduleId)) {
+        incubate(module, true);
+    }
+}
+
+bool ConfigurationPageCache::contains(QObject *module) const
+{
+    return module && m_pages.value(module->property("moduleId").toString());
+}
+
+void ConfigurationPageCache::clear()
+{
+    for (const auto &incubator : std::as_const(m_incubators)) {
+        incubator->clear();
+    }
+    m_incubators.clear();
+
+    const int maximumPages = m_maximumPages;
+    m_maximumPages = 0;
+    evict();
+    m_maximumPages = maximumPages;
+}
+
+void ConfigurationPageCache::incubate(QObject *module, bool preloaded)
+{
+    auto incubator = std::make_shared<Incubator>(this, module, preloaded);
+
+    // ConfigurationModule.page is a function returning the component of the page.
+    QJSValue pageFunction = module->property("page").value<QJSValue>();
+    auto component = qobject_cast<QQmlComponent *>(pageFunction.call().toQObject());
+    if (!component || !component->isReady()) {
+        qCWarning(SETTINGS_LOG) << "Unable to create component for moduleId" << incubator->moduleId
+                                << (component ? component->errorString() : u"page did not return a component"_s);
+        return;
+    }
+
+    QJSValue initialPropertiesFunction = module->property("initialProperties").value<QJSValue>();
+    if (initialPropertiesFunction.isCallable()) {
+        incubator->setInitialProperties(initialPropertiesFunction.call().toVariant().toMap());
+    }
+
+    m_incubators.insert(incubator->moduleId, incubator);
+    component->create(*incubator);
+}
+
+void ConfigurationPageCache::incubatorFinished(Incubator *incubator)
+{
+    if (incubator->isLoading() || incubator->isNull()) {
+        return;
+    }
+
+    // Keep the incubator alive until the end of this function.
+    const auto keepAlive = m_incubators.take(incubator->moduleId);
+    if (!keepAlive) {
+        return;
+    }
+
+    if (incubator->isError()) {
+        qCWarning(SETTINGS_LOG) << "Unable to create page for moduleId" << incubator->moduleId << incubator->errors();
+        return;
+    }
+
+    QObject *page = incubator->object();
+    QQmlEngine::setObjectOwnership(page, QQmlEngine::CppOwnership);
+    page->setParent(this);
+    if (incubator->module && page->property("title").toString().isEmpty()) {
+        page->setProperty("title", incubator->module->property("text"));
+    }
+
+    const qint64 elapsed = incubator->timer.elapsed();
+    qCDebug(SETTINGS_LOG) << "Created page for moduleId" << incubator->moduleId << "in" << elapsed << "ms" << (incubator->preloaded ? "(preloaded)" : "");
+
+    m_pages.insert(incubator->moduleId, page);
+    if (incubator->preloaded && !incubator->opened) {
+        addPreloaded(incubator->moduleId);
+    } else {
+        touch(incubator->moduleId);
+    }
+    Q_EMIT pageCreated(incubator->moduleId, elapsed, incubator->preloaded);
+}
+
+void ConfigurationPageCache::touch(const QString &moduleId)
+{
+    m_preloaded.remove(moduleId);
+    m_recentlyUsed.removeOne(moduleId);
+    m_recentlyUsed.prepend(moduleId);
+    evict();
+}
+
+void ConfigurationPageCache::addPreloaded(const QString &moduleId)
+{
+    // After the opened pages, and before the older preloaded ones, which go first.
+    m_recentlyUsed.removeOne(moduleId);
+    m_recentlyUsed.insert(openedPageCount(), moduleId);
+    m_preloaded.insert(moduleId);
+    evict();
+}
+
+qsizetype ConfigurationPageCache::openedPageCount() const
+{
+    return m_recentlyUsed.size() - m_preloaded.size();
+}
+
+void ConfigurationPageCache::evict()
+{
+    // Go through the least recently used pages first, and never destroy a page that is shown.
+    for (qsizetype i = m_recentlyUsed.size() - 1; i >= 0 && m_recentlyUsed.size() > m_maximumPages; --i) {
+        const QString moduleId = m_recentlyUsed.at(i);
+        const QPointer<QObject> page = m_pages.value(moduleId);
+        const auto item = qobject_cast<QQuickItem *>(page);
+        if (item && item->parentItem()) {
+            continue;
+        }
+        m_pages.remove(moduleId);
+        m_recentlyUsed.removeAt(i);
+        m_preloaded.remove(moduleId);
+        if (page) {
+            page->deleteLater();
+        }
+    }
+}
+
+#include "moc_configurationpagecache.cpp"
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QSet>
+#include <QStringList>
+#include <QtQml/qqmlregistration.h>
+
+#include <memory>
+
+class QQmlIncubator;
+
+/// \internal This is private API, do not use.
+///
+/// Creates and keeps the pages of ConfigurationModule objects, so that they
+/// survive the configuration window and are not created again each time
+/// their module is opened.
+///
+/// Pages can be created ahead of time with preload(), in small steps between
+/// frames, so that opening the modules the user is likely to open next does
+/// not block. Only the maximumPages most recently used pages are kept, except
+/// the ones currently shown. Preloaded pages the user did not open yet count
+/// as the least recently used ones, so they never push out opened pages.
+class ConfigurationPageCache : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+    Q_PROPERTY(int maximumPages READ maximumPages WRITE setMaximumPages NOTIFY maximumPagesChanged)
+
+public:
+    explicit ConfigurationPageCache(QObject *parent = nullptr);
+    ~ConfigurationPageCache() override;
+
+    int maximumPages() const;
+    void setMaximumPages(int maximumPages);
+
+    /// The page of @p module, created now if it is neither cached nor preloaded.
+    Q_INVOKABLE QObject *page(QObject *module);
+
+    /// Starts creating the page of @p module asynchronously, unless it already exists.
+    Q_INVOKABLE void preload(QObject *module);
+
+    /// Whether the page of @p module is created.
+    Q_INVOKABLE bool contains(QObject *module) const;
+
+    /// Destroys the pages which are not shown and cancels the preloading.
+    Q_INVOKABLE void clear();
+
+Q_SIGNALS:
+    void maximumPagesChanged();
+
+    /// Emitted when the page of the module @p moduleId got created, after @p elapsed milliseconds.
+    void pageCreated(const QString &moduleId, qint64 elapsed, bool preloaded);
+
+private:
+    class Incubator;
+
+    void incubate(QObject *module, bool preloaded);
+    void incubatorFinished(Incubator *incubator);
+    void touch(const QString &moduleId);
+    void addPreloaded(const QString &moduleId);
+    qsizetype openedPageCount() const;
+    void evict();
+
+    int m_maximumPages = 5;
+    QHash<QString, QPointer<QObject>> m_pages;
+    QHash<QString, std::shared_ptr<Incubator>> m_incubators;
+    QStringList m_recentlyUsed; // module ids, most recent first, then the preloaded ones
+    QSet<QString> m_preloaded; // pages not opened since they were preloaded
+};
@@ -0,0 +1,230 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "settingssearchindex.h"
+
+#include <QBitArray>
+#include <QHash>
+#include <QMetaProperty>
+
+#include <algorithm>
+
+using namespace Qt::StringLiterals;
+
+namespace
+{
+// The properties of ConfigurationModule that are searched.
+constexpr const char *searchedProperties[] = {"text", "category", "keywords"};
+
+// Scripts written without spaces between words.
+bool hasNoWordBreaks(QChar c)
+{
+    switch (c.script()) {
+    case QChar::Script_Han:
+    case QChar::Script_Hiragana:
+    case QChar::Script_Katakana:
+    case QChar::Script_Thai:
+    case QChar::Script_Lao:
+    case QChar::Script_Khmer:
+    case QChar::Script_Myanmar:
+        return true;
+    default:
+        return false;
+    }
+}
+}
+
+SettingsSearchIndex::SettingsSearchIndex(QObject *parent)
+    : QObject(parent)
+{
+}
+
+QList<QObject *> SettingsSearchIndex::modules() const
+{
+    QList<QObject *> modules;
+    modules.reserve(m_modules.size());
+    for (const auto &module : m_modules) {
+        modules.append(module.data());
+    }
+    return modules;
+}
+
+void SettingsSearchIndex::setModules(const QList<QObject *> &modules)
+{
+    if (this->modules() == modules) {
+        return;
+    }
+
+    for (const auto &module : std::as_const(m_modules)) {
+        if (module) {
+            disconnect(module, nullptr, this, nullptr);
+        }
+    }
+
+    m_modules.clear();
+    const QMetaMethod invalidateSlot = metaObject()->method(metaObject()->indexOfSlot("invalidate()"));
+    for (QObject *module : modules) {
+        m_modules.append(module);
+        if (!module) {
+            continue;
+        }
+        // Keywords are often translated strings, which change when the language does.
+        for (const char *name : searchedProperties) {
+            const QMetaObject *metaObject = module->metaObject();
+            const QMetaProperty property = metaObject->property(metaObject->indexOfProperty(name));
+            if (property.hasNotifySignal()) {
+                connect(module, property.notifySignal(), this, invalidateSlot);
+            }
+        }
+        connect(module, &QObject::destroyed, this, &SettingsSearchIndex::invalidate);
+    }
+
+    invalidate();
+    Q_EMIT modulesChanged();
+}
+
+int SettingsSearchIndex::revision() const
+{
+    return m_revision;
+}
+
+QList<int> SettingsSearchIndex::search(const QString &query)
+{
+    build();
+
+    const QStringList queryWords = tokenize(query, false);
+    QList<int> result;
+    if (queryWords.isEmpty()) {
+        result.reserve(m_modules.size());
+        for (int index = 0; index < m_modules.size(); ++index) {
+            result.append(index);
+        }
+        return result;
+    }
+
+    QBitArray matching(m_modules.size(), true);
+    for (const QString &queryWord : queryWords) {
+        // All the words starting with the query word are next to each other in sorted order.
+        QBitArray wordMatching(m_modules.size());
+        auto it = std::lower_bound(m_words.cbegin(), m_words.cend(), queryWord, [](const std::pair<QString, QList<int>> &entry, const QString &word) {
+            return entry.first < word;
+        });
+        for (; it != m_words.cend() && it->first.startsWith(queryWord); ++it) {
+            for (int index : it->second) {
+                wordMatching.setBit(index);
+            }
+        }
+
+        // Nothing starts with it, but it may still be part of a word.
+        if (wordMatching.count(true) == 0) {
+            for (const auto &[word, indexes] : m_words) {
+                if (word.contains(queryWord)) {
+                    for (int index : indexes) {
+                        wordMatching.setBit(index);
+                    }
+                }
+            }
+        }
+
+        matching &= wordMatching;
+        if (matching.count(true) == 0) {
+            return result;
+        }
+    }
+
+    for (int index = 0; index < matching.size(); ++index) {
+        if (matching.testBit(index)) {
+            result.append(index);
+        }
+    }
+    return result;
+}
+
+void SettingsSearchIndex::invalidate()
+{
+    m_dirty = true;
+
+    // Retranslating touches every module, so the changes are gathered before bindings search again.
+    if (m_revisionPending) {
+        return;
+    }
+    m_revisionPending = true;
+    QMetaObject::invokeMethod(
+        this,
+        [this] {
+            m_revisionPending = false;
+            ++m_revision;
+            Q_EMIT revisionChanged();
+        },
+        Qt::QueuedConnection);
+}
+
+QStringList SettingsSearchIndex::tokenize(const QString &text, bool withSuffixes)
+{
+    QStringList words;
+    const QString folded = text.toCaseFolded();
+    qsizetype start = -1;
+    bool unbroken = false;
+    for (qsizetype i = 0; i <= folded.size(); ++i) {
+        const bool isWordChar = i < folded.size() && folded.at(i).isLetterOrNumber();
+        const bool isUnbroken = isWordChar && hasNoWordBreaks(folded.at(i));
+        if (start >= 0 && (!isWordChar || isUnbroken != unbroken)) {
+            // Without spaces any position may start a word, so each suffix of the run is one.
+            const qsizetype last = withSuffixes && unbroken ? i - 1 : start;
+            for (qsizetype first = start; first <= last; ++first) {
+                words.append(folded.mid(first, i - first));
+            }
+            start = -1;
+        }
+        if (isWordChar && start < 0) {
+            start = i;
+            unbroken = isUnbroken;
+        }
+    }
+    return words;
+}
+
+void SettingsSearchIndex::build()
+{
+    if (!m_dirty) {
+        return;
+    }
+    m_dirty = false;
+
+    QHash<QString, QList<int>> words;
+    for (int index = 0; index < m_modules.size(); ++index) {
+        const QObject *module = m_modules.at(index);
+        if (!module) {
+            continue;
+        }
+
+        QStringList texts{module->property("text").toString()};
+        const QString category = module->property("category").toString();
+        // Modules in the default category are shown under "Settings", which is not worth searching for.
+        if (category != "_main_category"_L1) {
+            texts.append(category);
+        }
+        texts.append(module->property("keywords").toStringList());
+
+        for (const QString &text : std::as_const(texts)) {
+            for (const QString &word : tokenize(text, true)) {
+                QList<int> &indexes = words[word];
+                // Modules are visited in order, so a repeated word can only repeat the last index.
+                if (indexes.isEmpty() || indexes.constLast() != index) {
+                    indexes.append(index);
+                }
+            }
+        }
+    }
+
+    m_words.clear();
+    m_words.reserve(words.size());
+    for (auto it = words.cbegin(); it != words.cend(); ++it) {
+        m_words.emplace_back(it.key(), it.value());
+    }
+    std::sort(m_words.begin(), m_words.end(), [](const auto &left, const auto &right) {
+        return left.first < right.first;
+    });
+}
+
+#include "moc_settingssearchindex.cpp"
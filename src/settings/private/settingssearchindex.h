@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QtQml/qqmlregistration.h>
+
+#include <utility>
+#include <vector>
+
+/// \internal This is private API, do not use.
+///
+/// Inverted index over the text, category and keywords of a list of
+/// ConfigurationModule, so that the settings can be searched without creating
+/// the pages of the modules. The words are read and case folded once, on the
+/// first search after the modules or one of their properties changed.
+class SettingsSearchIndex : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+
+    Q_PROPERTY(QList<QObject *> modules READ modules WRITE setModules NOTIFY modulesChanged)
+
+    /// Changes when searches may give other results, once per event loop
+    /// iteration at most. Bindings calling search() should read it so that
+    /// they are evaluated again, e.g. after the text of a module was translated.
+    Q_PROPERTY(int revision READ revision NOTIFY revisionChanged)
+
+public:
+    explicit SettingsSearchIndex(QObject *parent = nullptr);
+
+    QList<QObject *> modules() const;
+    void setModules(const QList<QObject *> &modules);
+
+    int revision() const;
+
+    /// The indexes in modules of the modules matching @p query, in order.
+    ///
+    /// A module matches when every word of the query starts one of the words
+    /// of its text, category or keywords, ignoring case. A query word no word
+    /// starts with matches the words containing it instead. Text in scripts
+    /// written without spaces, such as Chinese, matches anywhere in a run of
+    /// that script. An empty query matches all modules.
+    Q_INVOKABLE QList<int> search(const QString &query);
+
+Q_SIGNALS:
+    void modulesChanged();
+    void revisionChanged();
+
+private Q_SLOTS:
+    void invalidate();
+
+private:
+    void build();
+    static QStringList tokenize(const QString &text, bool withSuffixes);
+
+    QList<QPointer<QObject>> m_modules;
+
+    bool m_dirty = true;
+    int m_revision = 0;
+    bool m_revisionPending = false; // revisionChanged() is queued
+    std::vector<std::pair<QString, QList<int>>> m_words; // case folded word and module indexes, sorted by word
+};
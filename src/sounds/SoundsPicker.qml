@@ -43,6 +43,24 @@ ListView {
      */
     property alias audioPlayer: playMusic
 
+    /**
+     * This property controls whether previews are played from pre-decoded
+     * audio of the visible entries when available, default to false
+     *
+     * When enabled, previews found in the cache are played by previewCache
+     * instead of audioPlayer, so audioPlayer.playbackState stays stopped for
+     * them and previewCache.playing tells whether a preview is playing. Such
+     * previews only last previewCache.previewDuration milliseconds.
+     */
+    property bool previewCacheEnabled: false
+
+    /**
+     * This property holds the cache of decoded previews, it can be used to
+     * tune its size limits and read its statistics
+     * \property SoundsPreviewCache previewCache
+     */
+    property alias previewCache: previewCache
+
     model: SoundsModel {
         id: soundsModel
         notification: listView.notification
@@ -50,15 +68,32 @@ ListView {
     }
 
     delegate: Delegates.RoundedItemDelegate {
+        id: soundDelegate
+
         required property string ringtoneName
         required property url sourceUrl
         required property int index
+        required property int duration
 
         text: ringtoneName
 
+        contentItem: Delegates.SubtitleContentItem {
+            itemDelegate: soundDelegate
+            // duration is read in the background and stays -1 until then
+            subtitle: soundDelegate.duration >= 0 ? listView.formatDuration(soundDelegate.duration) : ""
+        }
+
         icon.name: ListView.isCurrentItem ? "object-select-symbolic" : ""
         onClicked: {
+            const wasPreviewing = previewCache.isPlaying(sourceUrl);
+            previewCache.stop();
             selectedUrl = sourceUrl;
+            if (wasPreviewing) {
+                return;
+            }
+            if (listView.previewCacheEnabled && playMusic.playbackState !== MediaPlayer.PlayingState && previewCache.play(sourceUrl)) {
+                return;
+            }
             if (playMusic.playbackState === MediaPlayer.PlayingState) {
                 playMusic.pause();
             } else {
@@ -67,6 +102,34 @@ ListView {
         }
     }
 
+    onContentYChanged: prefetchTimer.restart()
+    onHeightChanged: prefetchTimer.restart()
+    onCountChanged: prefetchTimer.restart()
+
+    SoundsPreviewCache {
+        id: previewCache
+        model: soundsModel
+    }
+
+    // Only decode once scrolling settles.
+    Timer {
+        id: prefetchTimer
+        interval: 100
+        onTriggered: {
+            if (!listView.previewCacheEnabled || listView.count === 0) {
+                return;
+            }
+            const first = listView.indexAt(0, listView.contentY);
+            const last = listView.indexAt(0, listView.contentY + listView.height - 1);
+            previewCache.prefetch(Math.max(first, 0), last < 0 ? listView.count - 1 : last);
+        }
+    }
+
+    function formatDuration(msecs: int): string {
+        const seconds = Math.round(msecs / 1000);
+        return Math.floor(seconds / 60) + ":" + String(seconds % 60).padStart(2, "0");
+    }
+
     MediaPlayer {
         id: playMusic
         source: selectedUrl
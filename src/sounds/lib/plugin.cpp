@@ -7,6 +7,7 @@
 #include <QQmlExtensionPlugin>
 #include <QQmlEngine>
 #include "soundspickermodel.h"
+#include "soundspreviewcache.h"
 
 class SoundPickerPlugin : public QQmlExtensionPlugin
 {
@@ -29,6 +30,7 @@ void SoundPickerPlugin::initializeEngine(QQmlEngine *engine, const char *uri)
 void SoundPickerPlugin::registerTypes(const char *uri)
 {
     qmlRegisterType<SoundsPickerModel>(uri, 0, 1, "SoundsModel");
+    qmlRegisterType<SoundsPreviewCache>(uri, 0, 1, "SoundsPreviewCache");
 }
 
 #include "plugin.moc"
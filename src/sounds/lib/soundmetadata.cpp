@@ -0,0 +1,416 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "soundmetadata.h"
+
+#include <QDataStream>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QtEndian>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+// "SNDX", bump indexVersion whenever the serialized layout changes.
+constexpr quint32 indexMagic = 0x534E4458;
+constexpr quint32 indexVersion = 1;
+
+// Upper bound for header packets and metadata blocks we are willing to look at.
+// Comment blocks can embed cover art, the title is always before it in practice.
+constexpr qint64 maxHeaderSize = 256 * 1024;
+
+// The last Ogg page is searched for in this many bytes at the end of the file.
+constexpr qint64 oggTailSize = 64 * 1024;
+
+// Bounds-checked view over the mapped file.
+class ByteView
+{
+public:
+    ByteView(const uchar *data, qint64 size)
+        : m_data(data)
+        , m_size(size)
+    {
+    }
+
+    qint64 size() const
+    {
+        return m_size;
+    }
+
+    bool has(qint64 offset, qint64 length) const
+    {
+        return offset >= 0 && length >= 0 && offset <= m_size && length <= m_size - offset;
+    }
+
+    bool matches(qint64 offset, const char *magic, qint64 length) const
+    {
+        return has(offset, length) && std::memcmp(m_data + offset, magic, length) == 0;
+    }
+
+    const char *at(qint64 offset) const
+    {
+        return reinterpret_cast<const char *>(m_data + offset);
+    }
+
+    quint8 u8(qint64 offset) const
+    {
+        return m_data[offset];
+    }
+
+    quint16 le16(qint64 offset) const
+    {
+        return qFromLittleEndian<quint16>(m_data + offset);
+    }
+
+    quint32 le32(qint64 offset) const
+    {
+        return qFromLittleEndian<quint32>(m_data + offset);
+    }
+
+    quint64 le64(qint64 offset) const
+    {
+        return qFromLittleEndian<quint64>(m_data + offset);
+    }
+
+    quint32 be24(qint64 offset) const
+    {
+        return (quint32(m_data[offset]) << 16) | (quint32(m_data[offset + 1]) << 8) | quint32(m_data[offset + 2]);
+    }
+
+    quint32 be32(qint64 offset) const
+    {
+        return qFromBigEndian<quint32>(m_data + offset);
+    }
+
+private:
+    const uchar *m_data;
+    qint64 m_size;
+};
+
+// Vorbis comment structure, shared by Ogg Vorbis, Opus and FLAC.
+QString readVorbisCommentTitle(const ByteView &view, qint64 offset, qint64 end)
+{
+    end = std::min(end, view.size());
+    if (!view.has(offset, 4)) {
+        return {};
+    }
+    offset += 4 + qint64(view.le32(offset)); // vendor string
+    if (offset + 4 > end) {
+        return {};
+    }
+    const quint32 count = view.le32(offset);
+    offset += 4;
+
+    for (quint32 i = 0; i < count && offset + 4 <= end; ++i) {
+        const qint64 length = view.le32(offset);
+        offset += 4;
+        if (length > end - offset) {
+            break;
+        }
+        if (length > 6 && qstrnicmp(view.at(offset), "TITLE=", 6) == 0) {
+            return QString::fromUtf8(view.at(offset + 6), length - 6);
+        }
+        offset += length;
+    }
+    return {};
+}
+
+SoundMetadata readWav(const ByteView &view)
+{
+    SoundMetadata metadata;
+    quint32 byteRate = 0;
+    qint64 dataSize = -1;
+
+    qint64 offset = 12;
+    while (view.has(offset, 8)) {
+        const qint64 chunkSize = view.le32(offset + 4);
+        const qint64 body = offset + 8;
+
+        if (view.matches(offset, "fmt ", 4) && chunkSize >= 16 && view.has(body, 16)) {
+            metadata.channelCount = view.le16(body + 2);
+            metadata.sampleRate = view.le32(body + 4);
+            byteRate = view.le32(body + 8);
+        } else if (view.matches(offset, "data", 4)) {
+            // Streaming writers leave the size at 0 or 0xFFFFFFFF, assume it runs to the end.
+            dataSize = chunkSize == 0 || chunkSize == 0xFFFFFFFF ? view.size() - body : std::min(chunkSize, view.size() - body);
+        } else if (view.matches(offset, "LIST", 4) && view.matches(body, "INFO", 4)) {
+            const qint64 end = std::min(body + chunkSize, view.size());
+            qint64 sub = body + 4;
+            while (sub + 8 <= end) {
+                const qint64 subSize = view.le32(sub + 4);
+                if (view.matches(sub, "INAM", 4) && subSize <= end - sub - 8) {
+                    metadata.title = QString::fromUtf8(view.at(sub + 8), qstrnlen(view.at(sub + 8), subSize)).trimmed();
+                    break;
+                }
+                sub += 8 + subSize + (subSize & 1);
+            }
+        }
+
+        // Chunks are word aligned. Skipping the data chunk is pure arithmetic, its pages are never touched.
+        offset = body + chunkSize + (chunkSize & 1);
+    }
+
+    if (byteRate > 0 && dataSize >= 0) {
+        metadata.duration = dataSize * 1000 / byteRate;
+    }
+    return metadata;
+}
+
+// Reassembles the first @p count packets of the first logical Ogg stream.
+QList<QByteArray> readOggPackets(const ByteView &view, int count)
+{
+    QList<QByteArray> packets;
+    QByteArray packet;
+
+    qint64 offset = 0;
+    while (packets.size() < count && view.matches(offset, "OggS", 4) && view.has(offset, 27)) {
+        const int segments = view.u8(offset + 26);
+        const qint64 table = offset + 27;
+        if (!view.has(table, segments)) {
+            break;
+        }
+
+        qint64 data = table + segments;
+        for (int i = 0; i < segments && packets.size() < count; ++i) {
+            const int lacing = view.u8(table + i);
+            if (!view.has(data, lacing)) {
+                return packets;
+            }
+            if (packet.size() < maxHeaderSize) {
+                packet.append(view.at(data), lacing);
+            }
+            data += lacing;
+            if (lacing < 255) {
+                packets.append(packet);
+                packet.clear();
+            }
+        }
+
+        qint64 bodySize = 0;
+        for (int i = 0; i < segments; ++i) {
+            bodySize += view.u8(table + i);
+        }
+        offset = table + segments + bodySize;
+    }
+    return packets;
+}
+
+// Granule position of the last complete page, or -1.
+qint64 lastOggGranule(const ByteView &view)
+{
+    const qint64 start = std::max<qint64>(0, view.size() - oggTailSize);
+    for (qint64 offset = view.size() - 27; offset >= start; --offset) {
+        if (view.matches(offset, "OggS", 4)) {
+            const quint64 granule = view.le64(offset + 6);
+            if (granule != std::numeric_limits<quint64>::max()) {
+                return qint64(granule);
+            }
+        }
+    }
+    return -1;
+}
+
+SoundMetadata readOgg(const ByteView &view)
+{
+    SoundMetadata metadata;
+    const auto packets = readOggPackets(view, 2);
+    if (packets.isEmpty()) {
+        return metadata;
+    }
+
+    const ByteView identification(reinterpret_cast<const uchar *>(packets[0].constData()), packets[0].size());
+    const ByteView comments = packets.size() > 1 ? ByteView(reinterpret_cast<const uchar *>(packets[1].constData()), packets[1].size()) : ByteView(nullptr, 0);
+
+    qint64 granuleRate = 0;
+    qint64 preSkip = 0;
+    if (identification.matches(0, "\x01vorbis", 7) && identification.has(7, 9)) {
+        metadata.channelCount = identification.u8(11);
+        metadata.sampleRate = identification.le32(12);
+        granuleRate = metadata.sampleRate;
+        if (comments.matches(0, "\x03vorbis", 7)) {
+            metadata.title = readVorbisCommentTitle(comments, 7, comments.size());
+        }
+    } else if (identification.matches(0, "OpusHead", 8) && identification.has(8, 8)) {
+        // Opus always decodes at 48 kHz, the header only records the original rate.
+        metadata.channelCount = identification.u8(9);
+        preSkip = identification.le16(10);
+        metadata.sampleRate = identification.le32(12);
+        if (metadata.sampleRate == 0) {
+            metadata.sampleRate = 48000;
+        }
+        granuleRate = 48000;
+        if (comments.matches(0, "OpusTags", 8)) {
+            metadata.title = readVorbisCommentTitle(comments, 8, comments.size());
+        }
+    } else {
+        return metadata;
+    }
+
+    const qint64 granule = lastOggGranule(view);
+    if (granuleRate > 0 && granule > preSkip) {
+        metadata.duration = (granule - preSkip) * 1000 / granuleRate;
+    }
+    return metadata;
+}
+
+SoundMetadata readFlac(const ByteView &view, qint64 offset)
+{
+    SoundMetadata metadata;
+    offset += 4; // "fLaC"
+
+    bool last = false;
+    while (!last && view.has(offset, 4)) {
+        const quint8 header = view.u8(offset);
+        last = header & 0x80;
+        const int type = header & 0x7f;
+        const qint64 length = view.be24(offset + 1);
+        const qint64 body = offset + 4;
+
+        if (type == 0 && length >= 18 && view.has(body, 18)) {
+            // STREAMINFO: 20 bits sample rate, 3 bits channels - 1, 5 bits bits per sample - 1, 36 bits total samples.
+            const qint64 bits = body + 10;
+            metadata.sampleRate = (quint32(view.u8(bits)) << 12) | (quint32(view.u8(bits + 1)) << 4) | (view.u8(bits + 2) >> 4);
+            metadata.channelCount = ((view.u8(bits + 2) >> 1) & 0x07) + 1;
+            const quint64 totalSamples = (quint64(view.u8(bits + 3) & 0x0f) << 32) | view.be32(bits + 4);
+            if (metadata.sampleRate > 0 && totalSamples > 0) {
+                metadata.duration = qint64(totalSamples * 1000 / quint64(metadata.sampleRate));
+            }
+        } else if (type == 4 && length <= maxHeaderSize) {
+            metadata.title = readVorbisCommentTitle(view, body, body + length);
+        }
+
+        offset = body + length;
+    }
+    return metadata;
+}
+}
+
+SoundMetadata readSoundMetadata(const QString &filePath)
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly) || file.size() < 12) {
+        return {};
+    }
+
+    // Mapping the whole file is free, only the pages we actually read get loaded.
+    const uchar *data = file.map(0, file.size());
+    if (!data) {
+        qWarning() << "Unable to map" << filePath << file.errorString();
+        return {};
+    }
+    const ByteView view(data, file.size());
+
+    SoundMetadata metadata;
+    if (view.matches(0, "RIFF", 4) && view.matches(8, "WAVE", 4)) {
+        metadata = readWav(view);
+    } else if (view.matches(0, "OggS", 4)) {
+        metadata = readOgg(view);
+    } else {
+        qint64 offset = 0;
+        // Some taggers put an ID3v2 tag in front of FLAC streams.
+        if (view.matches(0, "ID3", 3) && view.has(0, 10)) {
+            offset = 10 + ((qint64(view.u8(6) & 0x7f) << 21) | (qint64(view.u8(7) & 0x7f) << 14) | (qint64(view.u8(8) & 0x7f) << 7) | qint64(view.u8(9) & 0x7f));
+            if (view.u8(5) & 0x10) {
+                offset += 10; // footer
+            }
+        }
+        if (view.matches(offset, "fLaC", 4)) {
+            metadata = readFlac(view, offset);
+        }
+    }
+
+    file.unmap(const_cast<uchar *>(data));
+    return metadata;
+}
+
+SoundMetadataIndex::SoundMetadataIndex()
+    : m_fileName(QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation) + QStringLiteral("/lingmoui-addons/soundmetadata.index"))
+{
+}
+
+void SoundMetadataIndex::load()
+{
+    if (m_loaded) {
+        return;
+    }
+    m_loaded = true;
+
+    QFile file(m_fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    QDataStream stream(&file);
+    quint32 magic = 0;
+    quint32 version = 0;
+    stream >> magic >> version;
+    if (magic != indexMagic || version != indexVersion) {
+        return;
+    }
+
+    qint32 count = 0;
+    stream >> count;
+    if (count < 0) {
+        return;
+    }
+    // A damaged count must not make us allocate more than the file could hold.
+    m_entries.reserve(std::min<qint64>(count, file.size() / 32));
+    for (qint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+        QString path;
+        Entry entry;
+        stream >> path >> entry.size >> entry.lastModified >> entry.metadata.duration >> entry.metadata.channelCount >> entry.metadata.sampleRate
+            >> entry.metadata.title;
+        if (stream.status() == QDataStream::Ok) {
+            m_entries.insert(path, entry);
+        }
+    }
+}
+
+void SoundMetadataIndex::save()
+{
+    if (!m_dirty) {
+        return;
+    }
+
+    QDir().mkpath(QFileInfo(m_fileName).absolutePath());
+    QSaveFile file(m_fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Unable to write sound metadata index" << m_fileName << file.errorString();
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream << indexMagic << indexVersion << qint32(m_entries.size());
+    for (auto it = m_entries.cbegin(); it != m_entries.cend(); ++it) {
+        const Entry &entry = it.value();
+        stream << it.key() << entry.size << entry.lastModified << entry.metadata.duration << entry.metadata.channelCount << entry.metadata.sampleRate
+               << entry.metadata.title;
+    }
+
+    if (file.commit()) {
+        m_dirty = false;
+    }
+}
+
+SoundMetadataIndex::Entry SoundMetadataIndex::entry(const QString &filePath) const
+{
+    return m_entries.value(filePath);
+}
+
+void SoundMetadataIndex::insert(const QString &filePath, const Entry &entry)
+{
+    m_entries.insert(filePath, entry);
+    m_dirty = true;
+}
+
+bool SoundMetadataIndex::isDirty() const
+{
+    return m_dirty;
+}
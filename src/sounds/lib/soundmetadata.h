@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QDateTime>
+#include <QHash>
+#include <QString>
+
+/// Audio properties read from the header of a sound file.
+struct SoundMetadata {
+    qint64 duration = -1; ///< Duration in milliseconds, -1 if unknown.
+    int channelCount = 0;
+    int sampleRate = 0;
+    QString title; ///< Embedded title (RIFF INAM or Vorbis comment TITLE), if any.
+
+    bool isValid() const
+    {
+        return sampleRate > 0;
+    }
+};
+
+/**
+ * Parse the header of a WAV, Ogg (Vorbis/Opus) or FLAC file.
+ *
+ * The file is memory-mapped and only the header bytes are touched, plus the
+ * last Ogg page for Ogg files since that is where the total length lives.
+ *
+ * This function is reentrant and is meant to be called from a worker thread.
+ */
+SoundMetadata readSoundMetadata(const QString &filePath);
+
+/**
+ * Small on-disk index of SoundMetadata keyed by path, size and modification time,
+ * so that unchanged files do not need to be parsed again on the next start.
+ *
+ * This class is not thread-safe and is owned by the GUI thread.
+ */
+class SoundMetadataIndex
+{
+public:
+    struct Entry {
+        qint64 size = -1;
+        QDateTime lastModified;
+        SoundMetadata metadata;
+    };
+
+    SoundMetadataIndex();
+
+    void load();
+    void save();
+
+    /// Returns the cached entry for @p filePath, it is up to the caller to validate size and mtime.
+    Entry entry(const QString &filePath) const;
+    void insert(const QString &filePath, const Entry &entry);
+
+    bool isDirty() const;
+
+private:
+    QString m_fileName;
+    QHash<QString, Entry> m_entries;
+    bool m_dirty = false;
+    bool m_loaded = false;
+};
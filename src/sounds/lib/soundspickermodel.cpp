@@ -3,10 +3,16 @@
 
 #include "soundspickermodel.h"
 
+#include <algorithm>
 #include <vector>
 
 #include <QDirIterator>
+#include <QFileInfo>
+#include <QSet>
 #include <QStandardPaths>
+#include <QThread>
+#include <QThreadPool>
+#include <QTimer>
 
 class SoundsPickerModel::Private
 {
@@ -15,12 +21,29 @@ public:
     std::vector<QString> soundsVec;
     bool notification = false;
     QString theme = QStringLiteral("lingmo-mobile");
+
+    // Header parsing happens here, never on the GUI thread.
+    QThreadPool pool;
+    SoundMetadataIndex index;
+    QHash<QString, SoundMetadata> metadata;
+    QSet<QString> pending;
+    QTimer saveTimer;
 };
 
 SoundsPickerModel::SoundsPickerModel(QObject *parent)
     : QAbstractListModel(parent)
     , d(std::make_unique<Private>())
 {
+    d->pool.setMaxThreadCount(std::min(QThread::idealThreadCount(), 2));
+
+    // Coalesce index writes while a directory is being parsed.
+    d->saveTimer.setSingleShot(true);
+    d->saveTimer.setInterval(2000);
+    connect(&d->saveTimer, &QTimer::timeout, this, [this]() {
+        d->index.save();
+    });
+
+    d->index.load();
     loadFiles();
 }
 
@@ -45,15 +68,78 @@ void SoundsPickerModel::loadFiles()
             }
         }
     }
+
+    requestMetadata();
+}
+
+void SoundsPickerModel::requestMetadata()
+{
+    for (const auto &path : d->soundsVec) {
+        if (d->metadata.contains(path) || d->pending.contains(path)) {
+            continue;
+        }
+
+        // Show what we know from the last run right away, the worker only confirms it.
+        const auto cached = d->index.entry(path);
+        if (cached.size >= 0) {
+            d->metadata.insert(path, cached.metadata);
+        }
+
+        d->pending.insert(path);
+        d->pool.start([this, path, cached]() {
+            const QFileInfo info(path);
+            SoundMetadataIndex::Entry entry;
+            entry.size = info.size();
+            entry.lastModified = info.lastModified();
+
+            const bool changed = entry.size != cached.size || entry.lastModified != cached.lastModified;
+            entry.metadata = changed ? readSoundMetadata(path) : cached.metadata;
+
+            QMetaObject::invokeMethod(
+                this,
+                [this, path, entry, changed]() {
+                    metadataLoaded(path, entry, changed);
+                },
+                Qt::QueuedConnection);
+        });
+    }
 }
 
-SoundsPickerModel::~SoundsPickerModel() = default;
+void SoundsPickerModel::metadataLoaded(const QString &path, const SoundMetadataIndex::Entry &entry, bool changed)
+{
+    d->pending.remove(path);
+    if (!changed) {
+        return;
+    }
+
+    d->metadata.insert(path, entry.metadata);
+    d->index.insert(path, entry);
+    d->saveTimer.start();
+
+    const auto it = std::find(d->soundsVec.cbegin(), d->soundsVec.cend(), path);
+    if (it != d->soundsVec.cend()) {
+        const auto changedIndex = index(std::distance(d->soundsVec.cbegin(), it));
+        Q_EMIT dataChanged(changedIndex, changedIndex, {DurationRole, ChannelCountRole, SampleRateRole, TitleRole});
+    }
+}
+
+SoundsPickerModel::~SoundsPickerModel()
+{
+    // Workers post back to this object, make sure none is left running.
+    d->pool.clear();
+    d->pool.waitForDone();
+    d->index.save();
+}
 
 QHash<int, QByteArray> SoundsPickerModel::roleNames() const
 {
     return {
         {Roles::NameRole, QByteArrayLiteral("ringtoneName")},
-        {Roles::UrlRole, QByteArrayLiteral("sourceUrl")}
+        {Roles::UrlRole, QByteArrayLiteral("sourceUrl")},
+        {Roles::DurationRole, QByteArrayLiteral("duration")},
+        {Roles::ChannelCountRole, QByteArrayLiteral("channelCount")},
+        {Roles::SampleRateRole, QByteArrayLiteral("sampleRate")},
+        {Roles::TitleRole, QByteArrayLiteral("title")},
     };
 }
 
@@ -111,6 +197,17 @@ QVariant SoundsPickerModel::data(const QModelIndex &index, int role) const
         }
         return ret;
     }
+
+    switch (role) {
+    case DurationRole:
+        return d->metadata.value(d->soundsVec.at(index.row())).duration;
+    case ChannelCountRole:
+        return d->metadata.value(d->soundsVec.at(index.row())).channelCount;
+    case SampleRateRole:
+        return d->metadata.value(d->soundsVec.at(index.row())).sampleRate;
+    case TitleRole:
+        return d->metadata.value(d->soundsVec.at(index.row())).title;
+    }
     return d->soundsVec.at(index.row());
 }
 int SoundsPickerModel::rowCount(const QModelIndex& parent) const {
@@ -5,6 +5,9 @@
 
 #include <QAbstractListModel>
 #include <memory>
+
+#include "soundmetadata.h"
+
 class SoundsPickerModel : public QAbstractListModel
 {
     Q_OBJECT
@@ -14,7 +17,11 @@ class SoundsPickerModel : public QAbstractListModel
 public:
     enum Roles {
         NameRole = Qt::UserRole,
-        UrlRole
+        UrlRole,
+        DurationRole, ///< Duration in milliseconds, -1 until the header has been read.
+        ChannelCountRole,
+        SampleRateRole,
+        TitleRole, ///< Title embedded in the file, empty if none.
     };
     
     explicit SoundsPickerModel(QObject *parent = nullptr);
@@ -40,6 +47,8 @@ Q_SIGNALS:
 private:
     void loadFiles();
     void rearrangeRingtoneOrder();
+    void requestMetadata();
+    void metadataLoaded(const QString &path, const SoundMetadataIndex::Entry &entry, bool changed);
     class Private;
     std::unique_ptr<Private> d;
 };
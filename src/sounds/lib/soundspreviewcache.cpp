@@ -0,0 +1,352 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "soundspreviewcache.h"
+
+#include <QAudioBuffer>
+#include <QAudioDecoder>
+#include <QAudioDevice>
+#include <QAudioSink>
+#include <QDebug>
+#include <QMediaDevices>
+
+#include <algorithm>
+#include <utility>
+
+SoundsPreviewCache::SoundsPreviewCache(QObject *parent)
+    : QObject(parent)
+    , m_decoder(new QAudioDecoder(this))
+{
+    connect(m_decoder, &QAudioDecoder::bufferReady, this, &SoundsPreviewCache::readBuffer);
+    connect(m_decoder, &QAudioDecoder::finished, this, &SoundsPreviewCache::finishDecoding);
+    connect(m_decoder, qOverload<QAudioDecoder::Error>(&QAudioDecoder::error), this, [this](QAudioDecoder::Error) {
+        qWarning() << "Unable to decode preview for" << m_decodingKey << m_decoder->errorString();
+        abortDecoding();
+        decodeNext();
+    });
+}
+
+SoundsPreviewCache::~SoundsPreviewCache()
+{
+    stop();
+}
+
+SoundsPickerModel *SoundsPreviewCache::model() const
+{
+    return m_model;
+}
+
+void SoundsPreviewCache::setModel(SoundsPickerModel *model)
+{
+    if (m_model == model) {
+        return;
+    }
+    m_model = model;
+    m_queue.clear();
+    abortDecoding();
+    Q_EMIT modelChanged();
+}
+
+int SoundsPreviewCache::previewDuration() const
+{
+    return m_previewDuration;
+}
+
+void SoundsPreviewCache::setPreviewDuration(int previewDuration)
+{
+    if (m_previewDuration == previewDuration) {
+        return;
+    }
+    m_previewDuration = previewDuration;
+    // Previews of a different length would be inconsistent.
+    clear();
+    Q_EMIT previewDurationChanged();
+}
+
+int SoundsPreviewCache::neighbourCount() const
+{
+    return m_neighbourCount;
+}
+
+void SoundsPreviewCache::setNeighbourCount(int neighbourCount)
+{
+    if (m_neighbourCount == neighbourCount) {
+        return;
+    }
+    m_neighbourCount = neighbourCount;
+    Q_EMIT neighbourCountChanged();
+}
+
+qint64 SoundsPreviewCache::maximumCacheSize() const
+{
+    return m_maximumCacheSize;
+}
+
+void SoundsPreviewCache::setMaximumCacheSize(qint64 maximumCacheSize)
+{
+    if (m_maximumCacheSize == maximumCacheSize) {
+        return;
+    }
+    m_maximumCacheSize = maximumCacheSize;
+    evict();
+    Q_EMIT maximumCacheSizeChanged();
+}
+
+qint64 SoundsPreviewCache::cacheSize() const
+{
+    return m_cacheSize;
+}
+
+int SoundsPreviewCache::entryCount() const
+{
+    return m_entries.size();
+}
+
+int SoundsPreviewCache::hitCount() const
+{
+    return m_hitCount;
+}
+
+int SoundsPreviewCache::missCount() const
+{
+    return m_missCount;
+}
+
+int SoundsPreviewCache::evictionCount() const
+{
+    return m_evictionCount;
+}
+
+bool SoundsPreviewCache::isPlaying() const
+{
+    return m_sink != nullptr;
+}
+
+bool SoundsPreviewCache::isPlaying(const QUrl &url) const
+{
+    return m_sink && m_playingKey == keyForUrl(url);
+}
+
+bool SoundsPreviewCache::contains(const QUrl &url) const
+{
+    return m_entries.contains(keyForUrl(url));
+}
+
+QString SoundsPreviewCache::keyForUrl(const QUrl &url)
+{
+    // SoundsPickerModel hands out plain paths, which QML turns into scheme-less urls.
+    return url.isLocalFile() ? url.toLocalFile() : url.toString(QUrl::PreferLocalFile);
+}
+
+void SoundsPreviewCache::prefetch(int firstVisible, int lastVisible)
+{
+    if (!m_model) {
+        return;
+    }
+
+    const int rowCount = m_model->rowCount({});
+    if (rowCount == 0) {
+        return;
+    }
+
+    firstVisible = std::clamp(firstVisible, 0, rowCount - 1);
+    lastVisible = std::clamp(lastVisible, firstVisible, rowCount - 1);
+
+    // Visible rows first, then the neighbours, closest ones first.
+    QList<int> rows;
+    for (int row = firstVisible; row <= lastVisible; ++row) {
+        rows << row;
+    }
+    for (int distance = 1; distance <= m_neighbourCount; ++distance) {
+        if (lastVisible + distance < rowCount) {
+            rows << lastVisible + distance;
+        }
+        if (firstVisible - distance >= 0) {
+            rows << firstVisible - distance;
+        }
+    }
+
+    QStringList queue;
+    for (const int row : std::as_const(rows)) {
+        const QString key = m_model->data(m_model->index(row), SoundsPickerModel::UrlRole).toString();
+        if (!key.isEmpty() && !m_entries.contains(key)) {
+            queue << key;
+        }
+    }
+
+    // The user scrolled away from what we are decoding.
+    if (!m_decodingKey.isEmpty() && !queue.contains(m_decodingKey)) {
+        abortDecoding();
+    }
+    queue.removeAll(m_decodingKey);
+    m_queue = queue;
+
+    decodeNext();
+}
+
+void SoundsPreviewCache::decodeNext()
+{
+    if (!m_decodingKey.isEmpty() || m_queue.isEmpty()) {
+        return;
+    }
+
+    m_decodingKey = m_queue.takeFirst();
+    m_decodedData.clear();
+    m_decodedFormat = {};
+
+    // Decode straight into something the output device accepts, so playback needs no conversion.
+    m_decoder->setAudioFormat(QMediaDevices::defaultAudioOutput().preferredFormat());
+    m_decoder->setSource(QUrl::fromLocalFile(m_decodingKey));
+    m_decoder->start();
+}
+
+void SoundsPreviewCache::readBuffer()
+{
+    const QAudioBuffer buffer = m_decoder->read();
+    if (!buffer.isValid() || m_decodingKey.isEmpty()) {
+        return;
+    }
+
+    m_decodedFormat = buffer.format();
+    m_decodedData.append(buffer.constData<char>(), buffer.byteCount());
+
+    if (m_decodedFormat.durationForBytes(int(m_decodedData.size())) >= qint64(m_previewDuration) * 1000) {
+        m_decoder->stop();
+        finishDecoding();
+    }
+}
+
+void SoundsPreviewCache::finishDecoding()
+{
+    if (m_decodingKey.isEmpty()) {
+        return;
+    }
+
+    if (m_decodedFormat.isValid() && !m_decodedData.isEmpty()) {
+        const int previewBytes = m_decodedFormat.bytesForDuration(qint64(m_previewDuration) * 1000);
+        if (m_decodedData.size() > previewBytes) {
+            m_decodedData.truncate(previewBytes);
+        }
+        insert(m_decodingKey, {m_decodedData, m_decodedFormat});
+    }
+
+    m_decodingKey.clear();
+    m_decodedData.clear();
+    decodeNext();
+}
+
+void SoundsPreviewCache::abortDecoding()
+{
+    if (m_decodingKey.isEmpty()) {
+        return;
+    }
+    m_decodingKey.clear();
+    m_decodedData.clear();
+    m_decoder->stop();
+}
+
+void SoundsPreviewCache::insert(const QString &key, const Entry &entry)
+{
+    m_entries.insert(key, entry);
+    m_recentlyUsed.prepend(key);
+    m_cacheSize += entry.pcm.size();
+    evict();
+    Q_EMIT statisticsChanged();
+}
+
+void SoundsPreviewCache::evict()
+{
+    bool evicted = false;
+    while (m_cacheSize > m_maximumCacheSize && !m_recentlyUsed.isEmpty()) {
+        const QString key = m_recentlyUsed.takeLast();
+        m_cacheSize -= m_entries.take(key).pcm.size();
+        ++m_evictionCount;
+        evicted = true;
+    }
+    if (evicted) {
+        Q_EMIT statisticsChanged();
+    }
+}
+
+bool SoundsPreviewCache::play(const QUrl &url)
+{
+    const QString key = keyForUrl(url);
+    const auto it = m_entries.constFind(key);
+    if (it == m_entries.cend()) {
+        ++m_missCount;
+        Q_EMIT statisticsChanged();
+
+        // Most likely asked for again soon.
+        if (m_decodingKey != key) {
+            m_queue.removeAll(key);
+            m_queue.prepend(key);
+            decodeNext();
+        }
+        return false;
+    }
+
+    // Shallow copy, the entry can be evicted while it plays.
+    const Entry entry = it.value();
+
+    ++m_hitCount;
+    m_recentlyUsed.removeOne(key);
+    m_recentlyUsed.prepend(key);
+    Q_EMIT statisticsChanged();
+
+    stop();
+
+    m_playbackBuffer.setData(entry.pcm);
+    m_playbackBuffer.open(QIODevice::ReadOnly);
+
+    m_sink = new QAudioSink(QMediaDevices::defaultAudioOutput(), entry.format, this);
+    connect(m_sink, &QAudioSink::stateChanged, this, [this](QAudio::State state) {
+        if (state == QAudio::IdleState || state == QAudio::StoppedState) {
+            stop();
+        }
+    });
+    m_playingKey = key;
+    m_sink->start(&m_playbackBuffer);
+
+    Q_EMIT playingChanged();
+    return true;
+}
+
+void SoundsPreviewCache::stop()
+{
+    if (!m_sink) {
+        return;
+    }
+
+    auto sink = std::exchange(m_sink, nullptr);
+    sink->disconnect(this);
+    sink->stop();
+    sink->deleteLater();
+    m_playbackBuffer.close();
+    m_playingKey.clear();
+
+    Q_EMIT playingChanged();
+}
+
+void SoundsPreviewCache::clear()
+{
+    m_queue.clear();
+    abortDecoding();
+
+    const bool wasEmpty = m_entries.isEmpty();
+    m_entries.clear();
+    m_recentlyUsed.clear();
+    m_cacheSize = 0;
+    if (!wasEmpty) {
+        Q_EMIT statisticsChanged();
+    }
+}
+
+void SoundsPreviewCache::resetStatistics()
+{
+    m_hitCount = 0;
+    m_missCount = 0;
+    m_evictionCount = 0;
+    Q_EMIT statisticsChanged();
+}
+
+#include "moc_soundspreviewcache.cpp"
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QAudioFormat>
+#include <QBuffer>
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QUrl>
+
+#include "soundspickermodel.h"
+
+class QAudioDecoder;
+class QAudioSink;
+
+/**
+ * Keeps the decoded beginning of the sounds around the visible part of a
+ * SoundsPickerModel in memory, so that previews start without the open and
+ * decode latency of a media player.
+ *
+ * Entries are evicted in least recently used order once maximumCacheSize is
+ * exceeded.
+ */
+class SoundsPreviewCache : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(SoundsPickerModel *model READ model WRITE setModel NOTIFY modelChanged)
+    Q_PROPERTY(int previewDuration READ previewDuration WRITE setPreviewDuration NOTIFY previewDurationChanged)
+    Q_PROPERTY(int neighbourCount READ neighbourCount WRITE setNeighbourCount NOTIFY neighbourCountChanged)
+    Q_PROPERTY(qint64 maximumCacheSize READ maximumCacheSize WRITE setMaximumCacheSize NOTIFY maximumCacheSizeChanged)
+    Q_PROPERTY(qint64 cacheSize READ cacheSize NOTIFY statisticsChanged)
+    Q_PROPERTY(int entryCount READ entryCount NOTIFY statisticsChanged)
+    Q_PROPERTY(int hitCount READ hitCount NOTIFY statisticsChanged)
+    Q_PROPERTY(int missCount READ missCount NOTIFY statisticsChanged)
+    Q_PROPERTY(int evictionCount READ evictionCount NOTIFY statisticsChanged)
+    Q_PROPERTY(bool playing READ isPlaying NOTIFY playingChanged)
+
+public:
+    explicit SoundsPreviewCache(QObject *parent = nullptr);
+    ~SoundsPreviewCache() override;
+
+    SoundsPickerModel *model() const;
+    void setModel(SoundsPickerModel *model);
+
+    /// Length of the decoded preview in milliseconds, default 5000.
+    int previewDuration() const;
+    void setPreviewDuration(int previewDuration);
+
+    /// Number of rows before and after the visible ones that get decoded, default 2.
+    int neighbourCount() const;
+    void setNeighbourCount(int neighbourCount);
+
+    /// Upper bound of decoded PCM kept in memory in bytes, default 16 MiB.
+    qint64 maximumCacheSize() const;
+    void setMaximumCacheSize(qint64 maximumCacheSize);
+
+    qint64 cacheSize() const;
+    int entryCount() const;
+    int hitCount() const;
+    int missCount() const;
+    int evictionCount() const;
+
+    bool isPlaying() const;
+
+    /// Decode the rows from @p firstVisible to @p lastVisible and their neighbours.
+    /// Pending work for rows outside of that range is dropped.
+    Q_INVOKABLE void prefetch(int firstVisible, int lastVisible);
+
+    /// Start playing the cached preview of @p url.
+    /// @return false on a cache miss, the caller should fall back to a media player.
+    Q_INVOKABLE bool play(const QUrl &url);
+    Q_INVOKABLE void stop();
+
+    Q_INVOKABLE bool contains(const QUrl &url) const;
+    Q_INVOKABLE bool isPlaying(const QUrl &url) const;
+
+    Q_INVOKABLE void clear();
+    Q_INVOKABLE void resetStatistics();
+
+Q_SIGNALS:
+    void modelChanged();
+    void previewDurationChanged();
+    void neighbourCountChanged();
+    void maximumCacheSizeChanged();
+    void statisticsChanged();
+    void playingChanged();
+
+private:
+    struct Entry {
+        QByteArray pcm;
+        QAudioFormat format;
+    };
+
+    static QString keyForUrl(const QUrl &url);
+    void decodeNext();
+    void readBuffer();
+    void finishDecoding();
+    void abortDecoding();
+    void insert(const QString &key, const Entry &entry);
+    void evict();
+
+    QPointer<SoundsPickerModel> m_model;
+    int m_previewDuration = 5000;
+    int m_neighbourCount = 2;
+    qint64 m_maximumCacheSize = 16 * 1024 * 1024;
+
+    QHash<QString, Entry> m_entries;
+    QStringList m_recentlyUsed; // most recent first
+    qint64 m_cacheSize = 0;
+    int m_hitCount = 0;
+    int m_missCount = 0;
+    int m_evictionCount = 0;
+
+    QAudioDecoder *m_decoder = nullptr;
+    QStringList m_queue;
+    QString m_decodingKey;
+    QByteArray m_decodedData;
+    QAudioFormat m_decodedFormat;
+
+    QAudioSink *m_sink = nullptr;
+    QBuffer m_playbackBuffer;
+    QString m_playingKey;
+};
@@ -70,6 +70,7 @@ LingmoUI.ApplicationWindow {
 
     Private.WindowStateSaver {
         id: windowStateSaver
+        savePolicy: Private.WindowStateSaver.WhenIdle
     }
 
     Connections {
@@ -5,6 +5,7 @@
 #include "commandbarfiltermodel_p.h"
 #include "actionsmodel_p.h"
 #include "shortcutsmodel_p.h"
+#include "startuptrace_p.h"
 #include <KAboutData>
 #include <KAuthorized>
 #include <KConfigGroup>
@@ -24,12 +25,18 @@ public:
     ShortcutsModel *shortcutsModel = nullptr;
     QObject *configurationView = nullptr;
     QAction *openConfigurationViewAction = nullptr;
+
+    // When the application was created, for the startup trace.
+    qint64 constructionTime = 0;
+    bool settingsRead = false;
 };
 
 AbstractLingmoUIApplication::AbstractLingmoUIApplication(QObject *parent)
     : QObject(parent)
     , d(std::make_unique<Private>())
 {
+    d->constructionTime = StartupTrace::now();
+    StartupTrace::Scope trace(u"AbstractLingmoUIApplication"_s);
     d->collection = new LingmoUIActionCollection(parent);
 }
 
@@ -73,14 +80,23 @@ static QList<KCommandBarModel::ActionGroup> actionCollectionToActionGroup(const
 
 void AbstractLingmoUIApplication::readSettings()
 {
+    StartupTrace::Scope trace(u"readSettings"_s);
     const auto collections = actionCollections();
     for (const auto collection : collections) {
+        StartupTrace::Scope collectionTrace(u"readSettings: %1"_s.arg(collection->componentName()), {{u"actions"_s, collection->count()}});
         collection->readSettings();
     }
+
+    // Applications read the settings once their actions are set up, usually from their constructor.
+    if (!d->settingsRead) {
+        d->settingsRead = true;
+        StartupTrace::addEvent(u"Application setup"_s, d->constructionTime, {{u"collections"_s, collections.size()}});
+    }
 }
 
 QSortFilterProxyModel *AbstractLingmoUIApplication::actionsModel()
 {
+    StartupTrace::Scope trace(u"actionsModel"_s);
     if (!d->proxyModel) {
         d->actionModel = new KCommandBarModel(this);
         d->proxyModel = new CommandBarFilterModel(this);
@@ -102,6 +118,7 @@ QSortFilterProxyModel *AbstractLingmoUIApplication::actionsModel()
 
 QAbstractListModel *AbstractLingmoUIApplication::shortcutsModel()
 {
+    StartupTrace::Scope trace(u"shortcutsModel"_s);
     if (!d->shortcutsModel) {
         d->shortcutsModel = new ShortcutsModel(this);
     }
@@ -139,8 +156,15 @@ LingmoUIActionCollection *AbstractLingmoUIApplication::mainCollection() const
 
 void AbstractLingmoUIApplication::setupActions()
 {
+    StartupTrace::Scope trace(u"AbstractLingmoUIApplication::setupActions"_s);
+
+    const auto authorizeAction = [](QLatin1StringView actionName) {
+        StartupTrace::Scope trace(u"KAuthorized: %1"_s.arg(actionName));
+        return KAuthorized::authorizeAction(actionName);
+    };
+
     auto actionName = QLatin1StringView("open_kcommand_bar");
-    if (KAuthorized::authorizeAction(actionName)) {
+    if (authorizeAction(actionName)) {
         auto openKCommandBarAction = d->collection->addAction(actionName, this, &AbstractLingmoUIApplication::openKCommandBarAction);
         openKCommandBarAction->setText(i18n("Open Command Bar"));
         openKCommandBarAction->setIcon(QIcon::fromTheme(QStringLiteral("new-command-alarm")));
@@ -150,26 +174,26 @@ void AbstractLingmoUIApplication::setupActions()
     }
 
     actionName = QLatin1StringView("file_quit");
-    if (KAuthorized::authorizeAction(actionName)) {
+    if (authorizeAction(actionName)) {
         auto action = KStandardActions::quit(this, &AbstractLingmoUIApplication::quit, this);
         d->collection->addAction(action->objectName(), action);
     }
 
     actionName = QLatin1StringView("options_configure_keybinding");
-    if (KAuthorized::authorizeAction(actionName)) {
+    if (authorizeAction(actionName)) {
         auto keyBindingsAction = KStandardActions::keyBindings(this, &AbstractLingmoUIApplication::shortcutsEditorAction, this);
         d->collection->addAction(keyBindingsAction->objectName(), keyBindingsAction);
     }
 
     actionName = QLatin1StringView("open_about_page");
-    if (KAuthorized::authorizeAction(actionName)) {
+    if (authorizeAction(actionName)) {
         auto action = d->collection->addAction(actionName, this, &AbstractLingmoUIApplication::openAboutPage);
         action->setText(i18n("About %1", KAboutData::applicationData().displayName()));
         action->setIcon(QIcon::fromTheme(QStringLiteral("help-about")));
     }
 
     actionName = QLatin1StringView("open_about_kde_page");
-    if (KAuthorized::authorizeAction(actionName)) {
+    if (authorizeAction(actionName)) {
         auto action = d->collection->addAction(actionName, this, &AbstractLingmoUIApplication::openAboutKDEPage);
         action->setText(i18n("About KDE"));
         action->setIcon(QIcon::fromTheme(QStringLiteral("kde")));
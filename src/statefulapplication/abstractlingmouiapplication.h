@@ -70,6 +70,16 @@
  * }
  * @endcode{}
  *
+ * To find out where the startup time goes, set the LINGMOUI_ADDONS_STARTUP_TRACE
+ * environment variable to a file path. The time spent creating the application,
+ * setting up its actions, checking them with KAuthorized and reading the shortcuts
+ * of each action collection is then written to this file when the application
+ * exits, in the Chrome trace event format.
+ *
+ * @code{.sh}
+ * LINGMOUI_ADDONS_STARTUP_TRACE=/tmp/startup.json mykoolapp
+ * @endcode
+ *
  * @since LingmoUIAddons 1.4.0
  */
 class LINGMOUIADDONSSTATEFULAPP_EXPORT AbstractLingmoUIApplication : public QObject
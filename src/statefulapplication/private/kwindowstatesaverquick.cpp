@@ -3,11 +3,51 @@
 
 #include "kwindowstatesaverquick.h"
 
+#include <QCoreApplication>
 #include <QQuickItem>
 #include <QQuickWindow>
 
+#include <KConfigGroup>
+#include <KSharedConfig>
+#include <KWindowConfig>
 #include <KWindowStateSaver>
 
+namespace
+{
+// The state of every window goes to the same file, one sync saves them all.
+QTimer *stateConfigSyncTimer()
+{
+    static QPointer<QTimer> timer;
+    if (!timer) {
+        timer = new QTimer(QCoreApplication::instance());
+        timer->setSingleShot(true);
+        timer->setInterval(1000);
+        QObject::connect(timer, &QTimer::timeout, [] {
+            KSharedConfig::openStateConfig()->sync();
+        });
+    }
+    return timer;
+}
+
+void scheduleStateConfigSync()
+{
+    stateConfigSyncTimer()->start();
+}
+
+void flushStateConfig()
+{
+    if (stateConfigSyncTimer()->isActive()) {
+        stateConfigSyncTimer()->stop();
+        KSharedConfig::openStateConfig()->sync();
+    }
+}
+}
+
+KWindowStateSaverQuick::~KWindowStateSaverQuick()
+{
+    save();
+}
+
 void KWindowStateSaverQuick::classBegin()
 {
 }
@@ -26,7 +66,56 @@ void KWindowStateSaverQuick::componentComplete()
         return;
     }
 
-    new KWindowStateSaver(window, m_configGroupName);
+    if (m_savePolicy == Immediately) {
+        new KWindowStateSaver(window, m_configGroupName);
+        return;
+    }
+
+    // Restore now, while the window is not shown yet, so that it is not resized after its first frame.
+    m_window = window;
+    KConfigGroup group = KSharedConfig::openStateConfig()->group(m_configGroupName);
+    KWindowConfig::restoreWindowSize(window, group);
+    KWindowConfig::restoreWindowPosition(window, group);
+
+    m_saveTimer.setSingleShot(true);
+    connect(&m_saveTimer, &QTimer::timeout, this, &KWindowStateSaverQuick::save);
+
+    connect(window, &QWindow::widthChanged, this, &KWindowStateSaverQuick::windowStateChanged);
+    connect(window, &QWindow::heightChanged, this, &KWindowStateSaverQuick::windowStateChanged);
+    connect(window, &QWindow::xChanged, this, &KWindowStateSaverQuick::windowStateChanged);
+    connect(window, &QWindow::yChanged, this, &KWindowStateSaverQuick::windowStateChanged);
+    connect(window, &QWindow::windowStateChanged, this, &KWindowStateSaverQuick::windowStateChanged);
+    connect(window, &QWindow::visibleChanged, this, [this](bool visible) {
+        if (!visible) {
+            save();
+        }
+    });
+    connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, this, [this] {
+        save();
+        flushStateConfig();
+    });
+}
+
+void KWindowStateSaverQuick::windowStateChanged()
+{
+    m_dirty = true;
+    if (m_savePolicy == WhenIdle) {
+        m_saveTimer.start(m_saveDelay);
+    }
+}
+
+void KWindowStateSaverQuick::save()
+{
+    m_saveTimer.stop();
+    if (!m_dirty || !m_window) {
+        return;
+    }
+    m_dirty = false;
+
+    KConfigGroup group = KSharedConfig::openStateConfig()->group(m_configGroupName);
+    KWindowConfig::saveWindowSize(m_window, group);
+    KWindowConfig::saveWindowPosition(m_window, group);
+    scheduleStateConfigSync();
 }
 
 void KWindowStateSaverQuick::setConfigGroupName(const QString &name)
@@ -42,4 +131,30 @@ QString KWindowStateSaverQuick::configGroupName() const
     return m_configGroupName;
 }
 
-#include "moc_kwindowstatesaverquick.cpp"
\ No newline at end of file
+KWindowStateSaverQuick::SavePolicy KWindowStateSaverQuick::savePolicy() const
+{
+    return m_savePolicy;
+}
+
+void KWindowStateSaverQuick::setSavePolicy(SavePolicy savePolicy)
+{
+    if (m_savePolicy != savePolicy) {
+        m_savePolicy = savePolicy;
+        Q_EMIT savePolicyChanged();
+    }
+}
+
+int KWindowStateSaverQuick::saveDelay() const
+{
+    return m_saveDelay;
+}
+
+void KWindowStateSaverQuick::setSaveDelay(int saveDelay)
+{
+    if (m_saveDelay != saveDelay) {
+        m_saveDelay = saveDelay;
+        Q_EMIT saveDelayChanged();
+    }
+}
+
+#include "moc_kwindowstatesaverquick.cpp"
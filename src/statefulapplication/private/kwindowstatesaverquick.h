@@ -4,7 +4,11 @@
 #ifndef KWINDOWSTATESAVER_QUICK_H
 #define KWINDOWSTATESAVER_QUICK_H
 
+#include <QPointer>
 #include <QQmlEngine>
+#include <QTimer>
+
+class QWindow;
 
 /**
  * @brief Creates a @c KWindowStateSaver in QML, and assigns it to the window it's parented to.
@@ -24,6 +28,12 @@
  *     }
  * }
  * @endcode
+ *
+ * By default the state is written each time the window moves or is resized,
+ * like KWindowStateSaver does. With savePolicy, it can instead be written once
+ * the window stopped changing for saveDelay milliseconds, or only when the
+ * window is closed. The state of all the windows is then saved to disk together.
+ *
  * @since 6.5
  *
  * @sa KWindowStateSaver
@@ -39,18 +49,60 @@ class KWindowStateSaverQuick : public QObject, public QQmlParserStatus
 
     Q_PROPERTY(QString configGroupName READ configGroupName WRITE setConfigGroupName NOTIFY configGroupNameChanged REQUIRED)
 
+    /**
+     * When the window state is written to the config. This is read when the
+     * component is completed, changing it afterwards has no effect.
+     *
+     * default: `WindowStateSaver.Immediately`
+     */
+    Q_PROPERTY(SavePolicy savePolicy READ savePolicy WRITE setSavePolicy NOTIFY savePolicyChanged)
+
+    /**
+     * How long the window must stay unchanged before its state is written, in
+     * milliseconds, with the WhenIdle policy.
+     *
+     * default: `500`
+     */
+    Q_PROPERTY(int saveDelay READ saveDelay WRITE setSaveDelay NOTIFY saveDelayChanged)
+
 public:
+    enum SavePolicy {
+        Immediately, ///< Write on every move and resize, through KWindowStateSaver.
+        WhenIdle, ///< Write once the window did not change for saveDelay milliseconds, and when it is closed.
+        WhenClosed, ///< Write only when the window is closed or the application quits.
+    };
+    Q_ENUM(SavePolicy)
+
+    ~KWindowStateSaverQuick() override;
+
     void classBegin() override;
     void componentComplete() override;
 
     void setConfigGroupName(const QString &name);
     QString configGroupName() const;
 
+    SavePolicy savePolicy() const;
+    void setSavePolicy(SavePolicy savePolicy);
+
+    int saveDelay() const;
+    void setSaveDelay(int saveDelay);
+
 Q_SIGNALS:
     void configGroupNameChanged();
+    void savePolicyChanged();
+    void saveDelayChanged();
 
 private:
+    void windowStateChanged();
+    void save();
+
     QString m_configGroupName;
+    SavePolicy m_savePolicy = Immediately;
+    int m_saveDelay = 500;
+
+    QPointer<QWindow> m_window;
+    QTimer m_saveTimer;
+    bool m_dirty = false;
 };
 
 #endif
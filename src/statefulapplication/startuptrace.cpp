@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "startuptrace_p.h"
+#include "debug.h"
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutex>
+#include <QThread>
+
+#include <chrono>
+
+using namespace Qt::StringLiterals;
+
+namespace
+{
+struct TraceEvent {
+    QString name;
+    qint64 start;
+    qint64 duration;
+    quintptr thread;
+    QVariantMap args;
+};
+
+struct Trace {
+    QString fileName = qEnvironmentVariable("LINGMOUI_ADDONS_STARTUP_TRACE");
+    QMutex mutex;
+    QList<TraceEvent> events;
+};
+
+Q_GLOBAL_STATIC(Trace, s_trace)
+
+void writeTrace()
+{
+    QMutexLocker locker(&s_trace->mutex);
+
+    QJsonArray traceEvents;
+    const qint64 pid = QCoreApplication::applicationPid();
+    for (const auto &event : std::as_const(s_trace->events)) {
+        traceEvents.append(QJsonObject{
+            {u"name"_s, event.name},
+            {u"cat"_s, u"startup"_s},
+            {u"ph"_s, u"X"_s},
+            {u"ts"_s, event.start},
+            {u"dur"_s, event.duration},
+            {u"pid"_s, pid},
+            {u"tid"_s, qint64(event.thread)},
+            {u"args"_s, QJsonObject::fromVariantMap(event.args)},
+        });
+    }
+
+    QFile file(s_trace->fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCWarning(BASEAPP_LOG) << "Unable to write the startup trace to" << s_trace->fileName << file.errorString();
+        return;
+    }
+    file.write(QJsonDocument(QJsonObject{
+                                 {u"traceEvents"_s, traceEvents},
+                                 {u"displayTimeUnit"_s, u"ms"_s},
+                             })
+                   .toJson(QJsonDocument::Compact));
+}
+}
+
+bool StartupTrace::isEnabled()
+{
+    return !s_trace->fileName.isEmpty();
+}
+
+qint64 StartupTrace::now()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void StartupTrace::addEvent(const QString &name, qint64 start, const QVariantMap &args)
+{
+    if (!isEnabled()) {
+        return;
+    }
+
+    const qint64 end = now();
+    QMutexLocker locker(&s_trace->mutex);
+    // The file is written once, when QCoreApplication is destroyed.
+    if (s_trace->events.isEmpty()) {
+        qAddPostRoutine(writeTrace);
+    }
+    s_trace->events.append({name, start, end - start, quintptr(QThread::currentThreadId()), args});
+}
+
+StartupTrace::Scope::Scope(const QString &name, const QVariantMap &args)
+    : m_enabled(isEnabled())
+{
+    if (m_enabled) {
+        m_name = name;
+        m_args = args;
+        m_start = now();
+    }
+}
+
+StartupTrace::Scope::~Scope()
+{
+    if (m_enabled) {
+        addEvent(m_name, m_start, m_args);
+    }
+}
@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2026 agent <agent@local>
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+
+#include <QString>
+#include <QVariantMap>
+
+/// \internal
+///
+/// Opt-in trace of the startup of the application, written in the Chrome
+/// trace event format so that it can be opened in chrome://tracing or Perfetto.
+///
+/// It is enabled by setting the LINGMOUI_ADDONS_STARTUP_TRACE environment
+/// variable to the path of the file to write, and is written when the
+/// application exits. When it is not set, the trace functions do nothing.
+namespace StartupTrace
+{
+/// Whether the trace is enabled.
+bool isEnabled();
+
+/// The current time, in microseconds, as used for the timestamps of the events.
+qint64 now();
+
+/// Records the event @p name, which started at @p start and ends now.
+void addEvent(const QString &name, qint64 start, const QVariantMap &args = {});
+
+/// Records the duration of the scope it lives in as an event.
+class Scope
+{
+public:
+    explicit Scope(const QString &name, const QVariantMap &args = {});
+    ~Scope();
+
+    Q_DISABLE_COPY_MOVE(Scope)
+
+private:
+    const bool m_enabled;
+    QString m_name;
+    QVariantMap m_args;
+    qint64 m_start = 0;
+};
+}
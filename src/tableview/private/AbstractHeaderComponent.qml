@@ -8,6 +8,8 @@ import QtQuick.Controls as QQC2
 
 import org.kde.lingmoui as LingmoUI
 
+import org.kde.lingmouiaddons.tableview as Tables
+
 /**
  * @brief Abstract header component.
  *
@@ -28,6 +30,32 @@ QtObject {
      */
     property real minimumWidth: LingmoUI.Units.gridUnit * 2
 
+    /**
+     * @brief How the width of the column is computed.
+     *
+     * - `TableColumnModel.Fixed`: the column is as wide as width.
+     * - `TableColumnModel.Minimum`: the column is as wide as minimumWidth.
+     * - `TableColumnModel.Stretch`: the column shares the width left by the other columns, see stretchFactor.
+     * - `TableColumnModel.ContentFit`: the column is as wide as contentWidth.
+     *
+     * default: `TableColumnModel.Fixed`
+     */
+    property int widthPolicy: Tables.TableColumnModel.Fixed
+
+    /**
+     * @brief The share of the remaining width a column with the Stretch policy gets, relative to the other stretched columns.
+     *
+     * default: `1`
+     */
+    property real stretchFactor: 1
+
+    /**
+     * @brief The width needed to show the contents of the column, used by the ContentFit policy.
+     *
+     * Falls back to width while it is 0.
+     */
+    property real contentWidth
+
     /**
      * @brief Column title.
      *
@@ -8,6 +8,8 @@ import QtQuick.Controls as QQC2
 
 import org.kde.lingmoui as LingmoUI
 
+import org.kde.lingmouiaddons.tableview as Tables
+
 Flickable {
     id: root
 
@@ -29,7 +31,6 @@ Flickable {
      * @see org::kde::lingmouiaddons::AbstractHeaderComponent
      */
     property list<AbstractHeaderComponent> headerComponents
-    onHeaderComponentsChanged: updateModel()
 
     /**
      * @brief This property holds the number of rows in the view
@@ -66,7 +67,7 @@ Flickable {
     /**
      * @brief The property is responsible for the direction in which sorting will be performed.
      *
-     * @note You must implement sorting yourself for this property to be valid.
+     * @note Unless sortingEnabled is set, you must implement sorting yourself for this property to be valid.
      * @see sortRole
      *
      * @property Qt::SortOrder sortOrder
@@ -76,22 +77,94 @@ Flickable {
     /**
      * @brief This property specifies based on which role the table will be sorted.
      *
-     * @note You must implement sorting yourself for this property to be valid.
+     * @note Unless sortingEnabled is set, you must implement sorting yourself for this property to be valid.
      * @see sortOrder
      */
     property int sortRole: -1
 
+    /**
+     * @brief This property holds whether the table sorts the model by itself, using sortRole and sortOrder.
+     *
+     * Rows are then shown through a sorting proxy, so row numbers given by the signals
+     * and the selectionModel refer to the sorted rows.
+     *
+     * default: `false`
+     *
+     * @see sortRole
+     * @see sortOrder
+     */
+    property bool sortingEnabled: false
+
+    /**
+     * @brief Roles used to order rows with equal sortRole values, when sortingEnabled is set.
+     *
+     * Each entry is an object with a role and an optional order, e.g.
+     * `[{ role: MyModel.NameRole, order: Qt.AscendingOrder }]`.
+     */
+    property alias secondarySortKeys: sortProxy.secondarySortKeys
+
+    /**
+     * @brief This property holds whether rows are fetched page by page as the table scrolls.
+     *
+     * The model has to implement canFetchMore() and fetchMore(). Placeholder rows are shown
+     * after the last row while fetching.
+     *
+     * default: `false`
+     *
+     * @see TablePagingProxyModel
+     */
+    property bool incrementalLoading: false
+
+    /**
+     * @brief The number of rows kept loaded around the visible ones when incrementalLoading is set, 0 for no limit.
+     *
+     * Only used with models that implement releaseRows() and fetchRows(), see TablePagingProxyModel.
+     * When sortingEnabled is set every row stays loaded, since sorting needs the data of all of them.
+     */
+    property alias maximumResidentRows: pagingProxy.maximumResidentRows
+
+    /**
+     * @brief This property holds whether more rows are being fetched.
+     */
+    readonly property bool loading: pagingProxy.loading
+
+    /**
+     * @brief The group of the application config the order of the columns is saved to.
+     *
+     * Columns moved by the user are shown in the same order the next time the table is created
+     * with the same group. Nothing is saved when empty.
+     *
+     * default: `""`
+     */
+    property alias columnOrderConfigGroup: columnModel.configGroup
+
     /**
      * @brief This property can be set to control which delegate items should be shown as selected, and which item should be shown as current.
      *
      * Using the selectionType and selectionMode properties you can adjust the selection behavior
      *
+     * @note When sortingEnabled or incrementalLoading is set, or columns are moved or hidden, the
+     * table shows the model through proxies. A selection model set here should be bound to viewModel,
+     * e.g. `ItemSelectionModel { model: table.viewModel }`, and indexes given to it created with
+     * `table.viewModel.index(row, column)`.
+     *
      * @property ItemSelectionModel selectionModel
      *
      * @see selectionType
      * @see selectionMode
      */
-    property ItemSelectionModel selectionModel: ItemSelectionModel { model: root.model }
+    property ItemSelectionModel selectionModel: ItemSelectionModel { model: root.__viewModel }
+
+    /**
+     * @brief The model the table shows, which is model itself unless sortingEnabled or
+     * incrementalLoading is set, or columns were moved or hidden.
+     *
+     * It changes when the user moves a column for the first time. Row and column numbers given
+     * by the signals and the selectionModel refer to this model.
+     *
+     * @see selectionModel
+     */
+    readonly property var viewModel: root.__viewModel
 
     /**
      * @brief This property holds whether the user can select cells, rows or columns.
@@ -119,19 +192,118 @@ Flickable {
     signal rowClicked(int row)
     signal rowDoubleClicked(int row)
 
-    readonly property var __columnModel: ListModel { id: columnModel }
+    readonly property Tables.TableColumnModel __columnModel: Tables.TableColumnModel {
+        id: columnModel
+        headerComponents: root.headerComponents
+        availableWidth: root.width
+    }
+    readonly property Tables.TableColumnMeasurer __columnMeasurer: Tables.TableColumnMeasurer {
+        model: root.__viewModel
+        columnModel: columnModel
+        font: LingmoUI.Theme.defaultFont
+        // The left and right padding of the default cell delegate.
+        padding: LingmoUI.Units.largeSpacing * 2
+        firstVisibleRow: root.__firstVisibleRow
+        lastVisibleRow: root.__lastVisibleRow
+    }
+    readonly property Tables.TableSortProxyModel __sortProxy: Tables.TableSortProxyModel {
+        id: sortProxy
+        model: root.sortingEnabled ? root.model : null
+        sortRole: root.sortRole
+        sortOrder: root.sortOrder
+    }
+    readonly property Tables.TablePagingProxyModel __pagingProxy: Tables.TablePagingProxyModel {
+        id: pagingProxy
+        model: root.incrementalLoading ? root.__sortedModel : null
+        firstVisibleRow: root.__firstVisibleRow
+        lastVisibleRow: root.__lastVisibleRow
+    }
+    // Shows the model columns in the order of the header, for views with one delegate per cell.
+    // Only in the way once the order differs from the model, so that untouched tables show the model itself.
+    readonly property Tables.TableColumnOrderProxyModel __columnOrderProxy: Tables.TableColumnOrderProxyModel {
+        id: columnOrderProxy
+        model: root.__remapColumns && columnModel.reordered ? root.__pagedModel : null
+        columns: columnModel.logicalColumns
+    }
+    readonly property var __sortedModel: sortProxy.sourceModel ? sortProxy : root.model
+    readonly property var __pagedModel: pagingProxy.sourceModel ? pagingProxy : __sortedModel
+    // The model the views show, sorted, paged and with reordered columns when the table does it by itself.
+    readonly property var __viewModel: columnOrderProxy.sourceModel ? columnOrderProxy : __pagedModel
+    property bool __remapColumns: false
+
+    readonly property int __firstVisibleRow: Math.floor(root.contentY / root.__rowHeight)
+    readonly property int __lastVisibleRow: Math.ceil((root.contentY + root.height) / root.__rowHeight)
+
+    // Shared by all the cells, so they do not need a theme object each.
+    readonly property QtObject __cellStyle: QtObject {
+        readonly property font font: LingmoUI.Theme.defaultFont
+        readonly property real padding: LingmoUI.Units.largeSpacing
+        readonly property color textColor: LingmoUI.Theme.textColor
+        readonly property color highlightedTextColor: LingmoUI.Theme.highlightedTextColor
+        readonly property color highlightColor: LingmoUI.Theme.highlightColor
+        readonly property color hoverColor: LingmoUI.Settings.isMobile ? "transparent" : Qt.alpha(LingmoUI.Theme.hoverColor, 0.3)
+        readonly property color alternateBackgroundColor: LingmoUI.Theme.alternateBackgroundColor
+        readonly property bool mirrored: root.LayoutMirroring.enabled || Qt.application.layoutDirection === Qt.RightToLeft
+    }
+
+    // Before Qt 6.7 the cells cannot draw their text themselves and load this instead.
+    readonly property Component __cellLabel: Component {
+        QQC2.Label {
+            readonly property Tables.TableTextCell cell: parent?.parent ?? null
+
+            LayoutMirroring.enabled: cell?.mirrored ?? false
+            text: cell?.text ?? ""
+            font: root.__cellStyle.font
+            color: cell?.highlighted ? root.__cellStyle.highlightedTextColor : root.__cellStyle.textColor
+            elide: Text.ElideRight
+            maximumLineCount: 1
+            verticalAlignment: Text.AlignVCenter
+        }
+    }
+
     readonly property real __rowHeight: root.compact ? LingmoUI.Units.gridUnit * 2
                                                      : LingmoUI.Units.gridUnit * 3
 
     property int __rowCount
     property int __columnCount: columnModel.count
 
+    readonly property Tables.TableSelectionHelper __selectionHelper: Tables.TableSelectionHelper {
+        selectionModel: root.selectionModel
+        selectionBehavior: root.selectionBehavior
+        selectionMode: root.selectionMode
+    }
+
     property bool __isControlModifier: false
     property bool __isShiftModifier: false
 
+    readonly property int __modifiers: (__isControlModifier ? Qt.ControlModifier : Qt.NoModifier)
+                                       | (__isShiftModifier ? Qt.ShiftModifier : Qt.NoModifier)
+
     Keys.onPressed: function(event) {
         __isControlModifier = event.modifiers & Qt.ControlModifier
         __isShiftModifier = event.modifiers & Qt.ShiftModifier
+
+        if (event.matches(StandardKey.SelectAll)) {
+            __selectionHelper.selectAll();
+            event.accepted = true;
+            return;
+        }
+
+        const horizontal = root.selectionBehavior === TableView.SelectCells || root.selectionBehavior === TableView.SelectColumns;
+        switch (event.key) {
+        case Qt.Key_Up:
+            event.accepted = __selectionHelper.moveCurrent(-1, 0, event.modifiers);
+            break;
+        case Qt.Key_Down:
+            event.accepted = __selectionHelper.moveCurrent(1, 0, event.modifiers);
+            break;
+        case Qt.Key_Left:
+            event.accepted = horizontal && __selectionHelper.moveCurrent(0, -1, event.modifiers);
+            break;
+        case Qt.Key_Right:
+            event.accepted = horizontal && __selectionHelper.moveCurrent(0, 1, event.modifiers);
+            break;
+        }
     }
 
     Keys.onReleased: function(event) {
@@ -145,6 +317,18 @@ Flickable {
 
     QQC2.Menu { id: menu }
 
+    // One tooltip for all the cells, shown over the hovered one when its text is elided.
+    QQC2.ToolTip {
+        id: cellToolTip
+
+        property Item cell: null
+
+        parent: cell ?? root
+        visible: cell !== null
+        text: cell?.text ?? ""
+        delay: LingmoUI.Units.toolTipDelay
+    }
+
     MouseArea {
         z: -2
         anchors.fill: parent
@@ -167,94 +351,31 @@ Flickable {
     }
 
     function updateModel(): void {
-        __columnModel.clear();
-        for(let index = 0; index < root.headerComponents.length; index++) {
-            let object = root.headerComponents[index];
-
-            if (object instanceof AbstractHeaderComponent && object.visible) {
-                __columnModel.append({ headerComponent: object });
-            }
-        }
+        // Kept for compatibility, the column model follows headerComponents by itself.
+        columnModel.headerComponents = Qt.binding(() => root.headerComponents);
     }
 
     function __columnsContentWidth(): real {
-        let contentWidth = 0
-
-        for(let index = 0; index < __columnModel.count; index++) {
-            let column = __columnModel.get(index).headerComponent;
-
-            if (column.visible) {
-                contentWidth += column.width;
-            }
-        }
-
-        return contentWidth
+        return columnModel.contentWidth;
     }
 
-    function __columnWidth(column: int, explicitWidth: real): real {
-        const columnItem = root.__columnModel.get(column).headerComponent;
-        if (!columnItem.resizable) {
-            return columnItem.width;
-        }
-
-        if (explicitWidth > 0) {
-            if (explicitWidth < columnItem.minimumWidth) {
-                return columnItem.minimumWidth;
-            }
-
-            return explicitWidth;
+    function __updateCellToolTip(cell: Item): void {
+        if (cell.hovered && cell.truncated) {
+            cellToolTip.cell = cell;
+        } else if (cellToolTip.cell === cell) {
+            cellToolTip.cell = null;
         }
-
-        return columnItem.width;
     }
 
     function __selectCell(row: int, column: int): void {
-        if (!root.selectionModel || root.selectionBehavior === TableView.SelectionDisabled) {
-            return;
-        }
-
-        const modelIndex = root.model.index(row, column);
-
-        if (__isControlModifier && root.selectionMode !== TableView.SingleSelection) {
-            root.selectionModel.setCurrentIndex(modelIndex, ItemSelectionModel.Toggle);
-
-            if (!root.selectionModel.hasSelection) {
-                root.selectionModel.clearSelection();
-                root.selectionModel.clearCurrentIndex();
-            }
-
-            return;
-        }
-
-        if (__isShiftModifier && root.selectionMode !== TableView.SingleSelection) {
-            const currentIndex = root.selectionModel.currentIndex;
-
-            const startRow = Math.min(row, currentIndex.row);
-            const endRow = Math.max(row, currentIndex.row);
-            const startColumn = Math.min(column, currentIndex.column);
-            const endColumn = Math.max(column, currentIndex.column);
-
-            for (let _row = startRow; _row <= endRow; _row++) {
-                for (let _column = startColumn; _column <= endColumn; _column++) {
-                    root.selectionModel.select(root.model.index(_row, _column), ItemSelectionModel.Select);
-                }
-            }
-
-            return;
-        }
-
-        root.selectionModel.setCurrentIndex(modelIndex, ItemSelectionModel.ClearAndSelect);
+        __selectionHelper.selectCell(row, column, __modifiers);
     }
 
     function __selectRow(row: int): void {
-        for (let column = 0; column < root.__columnCount; column++) {
-            __selectCell(row, column);
-        }
+        __selectionHelper.selectRow(row, __modifiers);
     }
 
     function __selectColumn(column: int): void {
-        for (let row = 0; row < root.__rowCount; row++) {
-            __selectCell(row, column);
-        }
+        __selectionHelper.selectColumn(column, __modifiers);
     }
 }
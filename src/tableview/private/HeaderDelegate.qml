@@ -120,6 +120,44 @@ QQC2.Control {
             }
         }
 
+        Item {
+            id: divider
+
+            anchors.right: parent.right
+            anchors.rightMargin: -delegate.rightPadding
+            width: LingmoUI.Units.smallSpacing * 2
+            height: parent.height
+            visible: delegate.headerComponent.resizable
+
+            HoverHandler {
+                cursorShape: Qt.SplitHCursor
+            }
+
+            TapHandler {
+                onDoubleTapped: __columnMeasurer.fitColumn(delegate.index)
+            }
+
+            DragHandler {
+                id: resizeHandler
+                target: null
+                yAxis.enabled: false
+                cursorShape: Qt.SplitHCursor
+
+                property real startWidth
+
+                onActiveChanged: {
+                    if (active) {
+                        startWidth = delegate.width;
+                    }
+                }
+                onTranslationChanged: {
+                    if (active) {
+                        __columnModel.resizeColumn(delegate.index, startWidth + translation.x);
+                    }
+                }
+            }
+        }
+
         onDropped: function(drop) {
             const currentItemIndex = delegate.index
             const dropItemIndex = drop.source.index
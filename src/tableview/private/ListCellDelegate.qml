@@ -4,27 +4,53 @@
  */
 
 import QtQuick
-import QtQuick.Controls as QQC2
-import QtQuick.Layouts
 
-import org.kde.lingmoui as LingmoUI
+import org.kde.lingmouiaddons.tableview as Tables
 
-QQC2.Control {
+// The row delegate draws the background and takes the clicks, the cell only draws the text.
+Tables.TableTextCell {
     id: delegate
 
     Accessible.role: Accessible.Cell
-    hoverEnabled: false
+    Accessible.name: text
 
     required property int index
-    required property var model
+    required property var headerComponent
 
     // Reference for current entry of root.model
     property var entry
     property int rowIndex
 
-    contentItem: Loader {
-        sourceComponent: delegate.model.headerComponent.itemDelegate
-        readonly property var modelData: delegate.entry[delegate.model.headerComponent.textRole]
+    readonly property bool __customDelegate: headerComponent.itemDelegate !== headerComponent.__baseDelegate
+    readonly property var __modelData: delegate.entry[delegate.headerComponent.textRole]
+
+    text: {
+        if (entry.placeholder) {
+            return "…";
+        }
+        return __customDelegate ? "" : (__modelData ?? "").toString();
+    }
+    font: root.__cellStyle.font
+    leftPadding: root.__cellStyle.padding
+    rightPadding: root.__cellStyle.padding
+    mirrored: root.__cellStyle.mirrored
+    textColor: root.__cellStyle.textColor
+    highlightedTextColor: root.__cellStyle.highlightedTextColor
+
+    onHoveredChanged: root.__updateCellToolTip(delegate)
+    onTruncatedChanged: root.__updateCellToolTip(delegate)
+
+    // Unchanged when a pooled row is reused, so the loaded item is kept.
+    // Shows the custom itemDelegate, or the text when the cell cannot draw it.
+    Loader {
+        anchors.fill: parent
+        // Inset like the text, custom delegates used to be the padded contentItem of a control.
+        anchors.leftMargin: delegate.leftPadding
+        anchors.rightMargin: delegate.rightPadding
+        active: delegate.__customDelegate ? !delegate.entry.placeholder : !delegate.drawsText
+        sourceComponent: delegate.__customDelegate ? delegate.headerComponent.itemDelegate : root.__cellLabel
+
+        readonly property var modelData: delegate.__modelData
         readonly property var model: delegate.entry
         readonly property int row: delegate.rowIndex
         readonly property int column: delegate.index
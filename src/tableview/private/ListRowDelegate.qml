@@ -50,13 +50,23 @@ QQC2.ItemDelegate {
             model: root.__columnModel
 
             delegate: ListCellDelegate {
-                implicitWidth: root.__columnModel.get(index).headerComponent.width
-                implicitHeight: root.__rowHeight
+                required property real columnWidth
+
+                width: columnWidth
+                height: root.__rowHeight
                 entry: delegate.model
                 rowIndex: delegate.index
+                highlighted: delegate.highlighted || delegate.down
             }
         }
     }
 
     onClicked: delegate.forceActiveFocus()
+
+    // A pooled row is shown again for another index, it must not keep the focus of this one.
+    ListView.onPooled: {
+        if (delegate.activeFocus) {
+            root.forceActiveFocus();
+        }
+    }
 }
@@ -4,15 +4,14 @@
  */
 
 import QtQuick
-import QtQuick.Controls as QQC2
 
-import org.kde.lingmoui as LingmoUI
+import org.kde.lingmouiaddons.tableview as Tables
 
-QQC2.ItemDelegate {
+Tables.TableTextCell {
     id: delegate
 
     Accessible.role: Accessible.Cell
-    highlighted: selected
+    Accessible.name: text
 
     required property int row
     required property var index
@@ -21,18 +20,46 @@ QQC2.ItemDelegate {
     required property bool selected
     required property var model
 
-    readonly property AbstractHeaderComponent headerComponent: __columnModel.get(column).headerComponent
+    readonly property AbstractHeaderComponent headerComponent: __columnModel.headerComponentAt(column)
 
-    Rectangle {
-        anchors.fill: parent
-        visible: delegate.current
-        color: "Transparent"
-        border.color: LingmoUI.Theme.highlightColor
+    // Columns with their own itemDelegate get it loaded on top, the cell only draws the background then.
+    // So does the Label showing the text when the cell cannot draw it.
+    readonly property bool __customDelegate: headerComponent.itemDelegate !== headerComponent.__baseDelegate
+    readonly property var __modelData: model.display ?? delegate.model[delegate.headerComponent.textRole]
+
+    text: {
+        if (model.placeholder) {
+            return "…";
+        }
+        return __customDelegate ? "" : (__modelData ?? "").toString();
     }
+    font: root.__cellStyle.font
+    leftPadding: root.__cellStyle.padding
+    rightPadding: root.__cellStyle.padding
+    mirrored: root.__cellStyle.mirrored
+
+    textColor: root.__cellStyle.textColor
+    highlightedTextColor: root.__cellStyle.highlightedTextColor
+    backgroundColor: root.alternatingRows && row % 2 ? root.__cellStyle.alternateBackgroundColor : "transparent"
+    highlightColor: root.__cellStyle.highlightColor
+    hoverColor: root.__cellStyle.hoverColor
+    borderColor: root.__cellStyle.highlightColor
 
-    contentItem: Loader {
-        sourceComponent: delegate.headerComponent.itemDelegate
-        readonly property var modelData: model.display ?? delegate.model[delegate.headerComponent.textRole]
+    highlighted: selected
+    showBorder: current
+    clickable: true
+
+    onHoveredChanged: root.__updateCellToolTip(delegate)
+    onTruncatedChanged: root.__updateCellToolTip(delegate)
+
+    Loader {
+        anchors.fill: parent
+        // Inset like the text, custom delegates used to be the padded contentItem of a control.
+        anchors.leftMargin: delegate.leftPadding
+        anchors.rightMargin: delegate.rightPadding
+        active: delegate.__customDelegate ? !delegate.model.placeholder : !delegate.drawsText
+        sourceComponent: delegate.__customDelegate ? delegate.headerComponent.itemDelegate : root.__cellLabel
+        readonly property var modelData: delegate.__modelData
         readonly property var index: delegate.index
         readonly property int row: delegate.row
         readonly property int column: delegate.column
@@ -16,6 +16,10 @@ Private.AbstractTable {
     contentWidth: header.contentWidth
     contentHeight: header.contentHeight + tableView.contentHeight
     selectionBehavior: TableView.SelectCells
+    // Moving a column only changes which model column each view column shows.
+    __remapColumns: true
+    // TableCellDelegate shows `model.display ?? model[textRole]`.
+    __columnMeasurer.displayRoleFirst: true
 
     signal cellClicked(int row, int column)
     signal cellDoubleClicked(int row, int column)
@@ -31,6 +35,7 @@ Private.AbstractTable {
         model: root.__columnModel
         syncView: tableView
         interactive: false
+        resizableColumns: false
 
         rowHeightProvider: () => root.__rowHeight
 
@@ -47,7 +52,7 @@ Private.AbstractTable {
 
         anchors.fill: parent
         anchors.topMargin: header.height
-        model: root.model
+        model: root.__viewModel
         interactive: false
 
         alternatingRows: root.alternatingRows
@@ -59,13 +64,8 @@ Private.AbstractTable {
         resizableRows: false
 
         rowHeightProvider: () => root.__rowHeight
-        columnWidthProvider: function(column) {
-            if (!isColumnLoaded(index)) {
-                return;
-            }
-
-            return root.__columnWidth(column, explicitColumnWidth(column))
-        }
+        // The widths are computed once per change by the column model, this only reads them back.
+        columnWidthProvider: column => root.__columnModel.columnWidth(column)
 
         delegate: Private.TableCellDelegate {
             onClicked: root.cellClicked(row, column)
@@ -73,6 +73,13 @@ Private.AbstractTable {
         }
     }
 
+    Connections {
+        target: root.__columnModel
+        function onColumnWidthsChanged() {
+            tableView.forceLayout();
+        }
+    }
+
     QQC2.SelectionRectangle {
         target: tableView
         topLeftHandle: null
@@ -86,29 +93,11 @@ Private.AbstractTable {
         }
 
         if (root.selectionBehavior === TableView.SelectRows) {
-            if (__isControlModifier || __isShiftModifier) {
-                __selectRow(row);
-                return
-            }
-
-            root.selectionModel.clearSelection();
-            root.selectionModel.clearCurrentIndex();
-            for (let _column = 0; _column < root.columnCount; _column++) {
-                root.selectionModel.setCurrentIndex(root.model.index(row, _column), ItemSelectionModel.Select);
-            }
+            __selectRow(row);
         }
 
         if (root.selectionBehavior === TableView.SelectColumns) {
-            if (__isControlModifier || __isShiftModifier) {
-                __selectColumn(column);
-                return;
-            }
-
-            root.selectionModel.clearSelection();
-            root.selectionModel.clearCurrentIndex();
-            for (let _row = 0; _row < root.rowCount; _row++) {
-                root.selectionModel.setCurrentIndex(root.model.index(_row, column), ItemSelectionModel.Select);
-            }
+            __selectColumn(column);
         }
     }
 }
@@ -8,22 +8,33 @@ import QtQuick.Controls as QQC2
 
 import org.kde.lingmoui as LingmoUI
 
+import org.kde.lingmouiaddons.tableview as Tables
+
 import "private" as Private
 
 Private.AbstractTable {
     id: root
 
-    contentWidth: __columnsContentWidth()
+    contentWidth: __columnModel.contentWidth
     contentHeight: listView.contentHeight
 
     __rowCount: listView.count
 
+    Tables.RowSelectionProxyModel {
+        id: selectionProxy
+        model: root.__viewModel
+        selectionModel: root.selectionModel
+    }
+
     ListView {
         id: listView
 
         anchors.fill: parent
-        model: root.model
+        // Row delegates only hear about selection changes of their own row.
+        model: selectionProxy.sourceModel ? selectionProxy : root.__viewModel
         interactive: false
+        // Rows scrolled out are kept with their cells and given to the rows scrolled in.
+        reuseItems: true
 
         header: QQC2.HorizontalHeaderView {
             id: header
@@ -33,20 +44,16 @@ Private.AbstractTable {
 
             model: root.__columnModel
             interactive: false
+            // Resizing goes through the column model, see HeaderDelegate.
+            resizableColumns: false
 
             rowHeightProvider: () => root.__rowHeight
-            columnWidthProvider: function(column) {
-                if (!isColumnLoaded(index)) {
-                    return;
-                }
-
-                return root.__columnWidth(column, explicitColumnWidth(column))
-            }
+            columnWidthProvider: column => root.__columnModel.columnWidth(column)
 
-            onLayoutChanged: {
-                for(let column = 0; column < root.columnCount; column++) {
-                    const columnItem = root.__columnModel.get(column).headerComponent;
-                    columnItem.width = columnWidthProvider(column)
+            Connections {
+                target: root.__columnModel
+                function onColumnWidthsChanged() {
+                    header.forceLayout();
                 }
             }
 
@@ -61,17 +68,9 @@ Private.AbstractTable {
         delegate: Private.ListRowDelegate {
             id: delegate
 
-            highlighted: root.selectionModel?.isSelected(root.model.index(index, 0)) ?? false
+            highlighted: model.rowSelected ?? false
             alternatingRows: root.alternatingRows
 
-            Connections {
-                target: root.selectionModel
-
-                function onSelectionChanged(selected, deselected) {
-                    delegate.highlighted = Qt.binding(() => root.selectionModel.isSelected(root.model.index(delegate.index, 0)))
-                }
-            }
-
             onClicked: root.rowClicked(index)
             onDoubleClicked: root.rowDoubleClicked(index)
         }
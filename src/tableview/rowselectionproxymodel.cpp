@@ -0,0 +1,137 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "rowselectionproxymodel.h"
+
+#include <algorithm>
+
+RowSelectionProxyModel::RowSelectionProxyModel(QObject *parent)
+    : QIdentityProxyModel(parent)
+{
+}
+
+QVariant RowSelectionProxyModel::model() const
+{
+    return QVariant::fromValue(sourceModel());
+}
+
+void RowSelectionProxyModel::setModel(const QVariant &model)
+{
+    setSourceModel(qobject_cast<QAbstractItemModel *>(model.value<QObject *>()));
+}
+
+QItemSelectionModel *RowSelectionProxyModel::selectionModel() const
+{
+    return m_selectionModel;
+}
+
+void RowSelectionProxyModel::setSelectionModel(QItemSelectionModel *selectionModel)
+{
+    if (m_selectionModel == selectionModel) {
+        return;
+    }
+
+    if (m_selectionModel) {
+        disconnect(m_selectionModel, nullptr, this, nullptr);
+    }
+
+    const QItemSelection previous = m_selectionModel ? m_selectionModel->selection() : QItemSelection();
+    m_selectionModel = selectionModel;
+
+    if (m_selectionModel) {
+        connect(m_selectionModel, &QItemSelectionModel::selectionChanged, this, &RowSelectionProxyModel::notifyRows);
+        connect(m_selectionModel, &QItemSelectionModel::modelChanged, this, [this] {
+            if (rowCount() > 0) {
+                Q_EMIT dataChanged(index(0, 0), index(rowCount() - 1, 0), {m_rowSelectedRole});
+            }
+        });
+    }
+
+    notifyRows(m_selectionModel ? m_selectionModel->selection() : QItemSelection(), previous);
+    Q_EMIT selectionModelChanged();
+}
+
+void RowSelectionProxyModel::setSourceModel(QAbstractItemModel *sourceModel)
+{
+    if (sourceModel == this->sourceModel()) {
+        return;
+    }
+    QIdentityProxyModel::setSourceModel(sourceModel);
+}
+
+void RowSelectionProxyModel::resetInternalData()
+{
+    QIdentityProxyModel::resetInternalData();
+    // Called by endResetModel() before modelReset is emitted, both when the
+    // source changes and when it resets itself, so views asking for
+    // roleNames() again get the new role.
+    updateRole();
+}
+
+void RowSelectionProxyModel::updateRole()
+{
+    const auto sourceRoles = sourceModel() ? sourceModel()->roleNames() : QHash<int, QByteArray>();
+    int role = Qt::UserRole + 1;
+    for (auto it = sourceRoles.cbegin(); it != sourceRoles.cend(); ++it) {
+        role = std::max(role, it.key() + 1);
+    }
+    m_rowSelectedRole = role;
+}
+
+QVariant RowSelectionProxyModel::data(const QModelIndex &index, int role) const
+{
+    if (role == m_rowSelectedRole) {
+        if (!m_selectionModel || !checkIndex(index, QAbstractItemModel::CheckIndexOption::IndexIsValid)) {
+            return false;
+        }
+        return m_selectionModel->isSelected(mapToSource(index).siblingAtColumn(0));
+    }
+    return QIdentityProxyModel::data(index, role);
+}
+
+QHash<int, QByteArray> RowSelectionProxyModel::roleNames() const
+{
+    auto roles = QIdentityProxyModel::roleNames();
+    roles.insert(m_rowSelectedRole, QByteArrayLiteral("rowSelected"));
+    return roles;
+}
+
+void RowSelectionProxyModel::notifyRows(const QItemSelection &selected, const QItemSelection &deselected)
+{
+    if (!sourceModel() || rowCount() == 0) {
+        return;
+    }
+
+    // Top level row spans touched by the change, whatever their columns.
+    QList<std::pair<int, int>> spans;
+    spans.reserve(selected.size() + deselected.size());
+    for (const QItemSelection *selection : {&selected, &deselected}) {
+        for (const QItemSelectionRange &range : *selection) {
+            if (range.isValid() && range.model() == sourceModel() && !range.parent().isValid()) {
+                spans.append({range.top(), range.bottom()});
+            }
+        }
+    }
+    if (spans.isEmpty()) {
+        return;
+    }
+
+    std::sort(spans.begin(), spans.end());
+
+    const int lastColumn = columnCount() - 1;
+    auto current = spans.constFirst();
+    for (auto it = std::next(spans.cbegin()); it != spans.cend(); ++it) {
+        if (it->first <= current.second + 1) {
+            current.second = std::max(current.second, it->second);
+            continue;
+        }
+        Q_EMIT dataChanged(index(current.first, 0), index(current.second, lastColumn), {m_rowSelectedRole});
+        current = *it;
+    }
+    Q_EMIT dataChanged(index(current.first, 0), index(current.second, lastColumn), {m_rowSelectedRole});
+}
+
+#include "moc_rowselectionproxymodel.cpp"
@@ -0,0 +1,58 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QIdentityProxyModel>
+#include <QItemSelectionModel>
+#include <QPointer>
+
+/**
+ * @brief Adds a rowSelected role to a model, telling whether the first cell
+ * of the row is selected in selectionModel.
+ *
+ * On a selection change only the rows covered by the selected and deselected
+ * ranges are reported through dataChanged(), merged into contiguous spans, so
+ * row delegates bound to the role are the only ones to update.
+ */
+class RowSelectionProxyModel : public QIdentityProxyModel
+{
+    Q_OBJECT
+
+    /**
+     * @brief The model to show, anything that is not a QAbstractItemModel is ignored.
+     *
+     * Convenience for views whose model can also be a JavaScript array.
+     */
+    Q_PROPERTY(QVariant model READ model WRITE setModel NOTIFY sourceModelChanged)
+    Q_PROPERTY(QItemSelectionModel *selectionModel READ selectionModel WRITE setSelectionModel NOTIFY selectionModelChanged)
+
+public:
+    explicit RowSelectionProxyModel(QObject *parent = nullptr);
+
+    QVariant model() const;
+    void setModel(const QVariant &model);
+
+    QItemSelectionModel *selectionModel() const;
+    void setSelectionModel(QItemSelectionModel *selectionModel);
+
+    void setSourceModel(QAbstractItemModel *sourceModel) override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+Q_SIGNALS:
+    void selectionModelChanged();
+
+protected Q_SLOTS:
+    void resetInternalData() override;
+
+private:
+    void updateRole();
+    void notifyRows(const QItemSelection &selected, const QItemSelection &deselected);
+
+    QPointer<QItemSelectionModel> m_selectionModel;
+    int m_rowSelectedRole = Qt::UserRole + 1;
+};
@@ -0,0 +1,380 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "tablecolumnmeasurer.h"
+
+#include "tablecolumnmodel.h"
+
+#include <QAbstractItemModel>
+#include <QFontMetricsF>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// Above this many rows, the rows scanned for long strings are picked with a
+// stride. Reading the model happens on the GUI thread, so this stays small.
+constexpr int ScanLimit = 2000;
+}
+
+TableColumnMeasurer::TableColumnMeasurer(QObject *parent)
+    : QObject(parent)
+{
+    m_pool.setMaxThreadCount(1);
+
+    m_contentFitTimer.setSingleShot(true);
+    m_contentFitTimer.setInterval(100);
+    connect(&m_contentFitTimer, &QTimer::timeout, this, &TableColumnMeasurer::updateContentFitColumns);
+}
+
+TableColumnMeasurer::~TableColumnMeasurer()
+{
+    m_pool.clear();
+    m_pool.waitForDone();
+}
+
+QVariant TableColumnMeasurer::model() const
+{
+    return QVariant::fromValue(m_model.data());
+}
+
+void TableColumnMeasurer::setModel(const QVariant &model)
+{
+    auto itemModel = qobject_cast<QAbstractItemModel *>(model.value<QObject *>());
+    if (m_model == itemModel) {
+        return;
+    }
+
+    if (m_model) {
+        disconnect(m_model, nullptr, this, nullptr);
+    }
+    m_model = itemModel;
+
+    if (m_model) {
+        connect(m_model, &QAbstractItemModel::dataChanged, this, [this](const QModelIndex &, const QModelIndex &, const QList<int> &roles) {
+            invalidate(roles);
+        });
+        const auto invalidateAll = [this] {
+            invalidate();
+        };
+        connect(m_model, &QAbstractItemModel::modelReset, this, invalidateAll);
+        connect(m_model, &QAbstractItemModel::rowsInserted, this, invalidateAll);
+        connect(m_model, &QAbstractItemModel::rowsRemoved, this, invalidateAll);
+    }
+
+    invalidate();
+    Q_EMIT modelChanged();
+}
+
+TableColumnModel *TableColumnMeasurer::columnModel() const
+{
+    return m_columnModel;
+}
+
+void TableColumnMeasurer::setColumnModel(TableColumnModel *columnModel)
+{
+    if (m_columnModel == columnModel) {
+        return;
+    }
+
+    if (m_columnModel) {
+        disconnect(m_columnModel, nullptr, this, nullptr);
+    }
+    m_columnModel = columnModel;
+
+    if (m_columnModel) {
+        // A column turning to ContentFit changes the geometry as well.
+        connect(m_columnModel, &TableColumnModel::modelReset, &m_contentFitTimer, qOverload<>(&QTimer::start));
+        connect(m_columnModel, &TableColumnModel::columnWidthsChanged, &m_contentFitTimer, qOverload<>(&QTimer::start));
+    }
+
+    m_contentFitTimer.start();
+    Q_EMIT columnModelChanged();
+}
+
+QFont TableColumnMeasurer::font() const
+{
+    return m_font;
+}
+
+void TableColumnMeasurer::setFont(const QFont &font)
+{
+    if (m_font == font) {
+        return;
+    }
+    m_font = font;
+    invalidate();
+    Q_EMIT fontChanged();
+}
+
+qreal TableColumnMeasurer::padding() const
+{
+    return m_padding;
+}
+
+void TableColumnMeasurer::setPadding(qreal padding)
+{
+    if (qFuzzyCompare(m_padding, padding)) {
+        return;
+    }
+    m_padding = padding;
+    m_contentFitTimer.start();
+    Q_EMIT paddingChanged();
+}
+
+int TableColumnMeasurer::sampleSize() const
+{
+    return m_sampleSize;
+}
+
+void TableColumnMeasurer::setSampleSize(int sampleSize)
+{
+    if (m_sampleSize == sampleSize) {
+        return;
+    }
+    m_sampleSize = sampleSize;
+    invalidate();
+    Q_EMIT sampleSizeChanged();
+}
+
+int TableColumnMeasurer::firstVisibleRow() const
+{
+    return m_firstVisibleRow;
+}
+
+void TableColumnMeasurer::setFirstVisibleRow(int firstVisibleRow)
+{
+    if (m_firstVisibleRow == firstVisibleRow) {
+        return;
+    }
+    // Only used by the next measurement, cached widths stay valid.
+    m_firstVisibleRow = firstVisibleRow;
+    Q_EMIT visibleRowsChanged();
+}
+
+int TableColumnMeasurer::lastVisibleRow() const
+{
+    return m_lastVisibleRow;
+}
+
+void TableColumnMeasurer::setLastVisibleRow(int lastVisibleRow)
+{
+    if (m_lastVisibleRow == lastVisibleRow) {
+        return;
+    }
+    m_lastVisibleRow = lastVisibleRow;
+    Q_EMIT visibleRowsChanged();
+}
+
+bool TableColumnMeasurer::displayRoleFirst() const
+{
+    return m_displayRoleFirst;
+}
+
+void TableColumnMeasurer::setDisplayRoleFirst(bool displayRoleFirst)
+{
+    if (m_displayRoleFirst == displayRoleFirst) {
+        return;
+    }
+    m_displayRoleFirst = displayRoleFirst;
+    m_contentFitTimer.start();
+    Q_EMIT displayRoleFirstChanged();
+}
+
+void TableColumnMeasurer::fitColumn(int column)
+{
+    if (!m_columnModel) {
+        return;
+    }
+
+    QObject *component = m_columnModel->headerComponentAt(column);
+    if (!component) {
+        return;
+    }
+
+    const Source source = sourceFor(component, column);
+    const auto cached = m_textWidths.constFind(source.key());
+    if (cached != m_textWidths.cend()) {
+        m_columnModel->resizeColumn(column, widthFor(component, *cached));
+        return;
+    }
+
+    if (!m_fitRequests.contains(component)) {
+        m_fitRequests.append(component);
+    }
+    measure(source);
+}
+
+TableColumnMeasurer::Source TableColumnMeasurer::sourceFor(const QObject *component, int column) const
+{
+    int role = -1;
+    const QByteArray textRole = component->property("textRole").toString().toUtf8();
+    if (m_model && !textRole.isEmpty()) {
+        role = m_model->roleNames().key(textRole, -1);
+    }
+    // Same lookup as the cell delegates: `model.display ?? model[textRole]`
+    // for TableCellDelegate, `entry[textRole]` of the row for ListCellDelegate.
+    if (m_displayRoleFirst) {
+        return {column, role, true};
+    }
+    return {0, role, false};
+}
+
+qreal TableColumnMeasurer::widthFor(const QObject *component, qreal textWidth) const
+{
+    const QFontMetricsF metrics(m_font);
+    const qreal titleWidth = metrics.horizontalAdvance(component->property("title").toString());
+    return std::ceil(std::max(textWidth, titleWidth) + m_padding);
+}
+
+void TableColumnMeasurer::measure(const Source &source)
+{
+    if (!m_model || m_measuring.contains(source.key())) {
+        return;
+    }
+
+    // Reading the model has to happen here, only the text layout is moved to the worker.
+    const int rowCount = m_model->rowCount();
+    QList<QString> sample;
+    if (source.column < m_model->columnCount()) {
+        const auto textAt = [this, &source](int row) {
+            const QModelIndex index = m_model->index(row, source.column);
+            QVariant value = source.displayRoleFirst ? index.data(Qt::DisplayRole) : QVariant();
+            if (!value.isValid() && source.role >= 0) {
+                value = index.data(source.role);
+            }
+            return value.toString();
+        };
+
+        // The longest strings by character count are kept in a min-heap.
+        QList<QString> longest;
+        longest.reserve(m_sampleSize + 1);
+        const auto shorter = [](const QString &left, const QString &right) {
+            return left.size() > right.size();
+        };
+        const int stride = std::max(1, rowCount / ScanLimit);
+        for (int row = 0; row < rowCount && m_sampleSize > 0; row += stride) {
+            QString text = textAt(row);
+            if (longest.size() == m_sampleSize && text.size() <= longest.constFirst().size()) {
+                continue;
+            }
+            longest.append(std::move(text));
+            std::push_heap(longest.begin(), longest.end(), shorter);
+            if (longest.size() > m_sampleSize) {
+                std::pop_heap(longest.begin(), longest.end(), shorter);
+                longest.removeLast();
+            }
+        }
+        sample = std::move(longest);
+
+        // Proportional fonts can make shorter strings wider, so what the user sees is measured too.
+        const int firstRow = std::clamp(m_firstVisibleRow, 0, rowCount);
+        const int lastRow = std::min(m_lastVisibleRow, rowCount - 1);
+        for (int row = firstRow; row <= lastRow; ++row) {
+            sample.append(textAt(row));
+        }
+    }
+
+    m_measuring.insert(source.key());
+    m_pool.start([this, font = m_font, sample, generation = m_generation, key = source.key()] {
+        const QFontMetricsF metrics(font);
+        qreal width = 0;
+        for (const QString &text : sample) {
+            width = std::max(width, metrics.horizontalAdvance(text));
+        }
+        QMetaObject::invokeMethod(
+            this,
+            [this, generation, key, width] {
+                applyResult(generation, key, width);
+            },
+            Qt::QueuedConnection);
+    });
+}
+
+void TableColumnMeasurer::applyResult(quint64 generation, quint64 key, qreal textWidth)
+{
+    m_measuring.remove(key);
+
+    const bool stale = generation != m_generation;
+    if (!stale) {
+        m_textWidths.insert(key, textWidth);
+    }
+    if (!m_columnModel) {
+        return;
+    }
+
+    for (int column = 0; column < m_columnModel->rowCount(); ++column) {
+        QObject *component = m_columnModel->headerComponentAt(column);
+        const Source source = sourceFor(component, column);
+        if (source.key() != key) {
+            continue;
+        }
+
+        if (stale) {
+            // The data changed while measuring, start over for columns still waiting on it.
+            if (m_fitRequests.contains(component) || component->property("widthPolicy").toInt() == TableColumnModel::ContentFit) {
+                measure(source);
+            }
+            continue;
+        }
+
+        const qreal width = widthFor(component, textWidth);
+        if (component->property("widthPolicy").toInt() == TableColumnModel::ContentFit) {
+            component->setProperty("contentWidth", width);
+        }
+        if (m_fitRequests.removeAll(component) > 0) {
+            m_columnModel->resizeColumn(column, width);
+        }
+    }
+}
+
+void TableColumnMeasurer::updateContentFitColumns()
+{
+    if (!m_columnModel || !m_model) {
+        return;
+    }
+
+    for (int column = 0; column < m_columnModel->rowCount(); ++column) {
+        QObject *component = m_columnModel->headerComponentAt(column);
+        if (component->property("widthPolicy").toInt() != TableColumnModel::ContentFit) {
+            continue;
+        }
+
+        const Source source = sourceFor(component, column);
+        const auto cached = m_textWidths.constFind(source.key());
+        if (cached == m_textWidths.cend()) {
+            measure(source);
+            continue;
+        }
+        const qreal width = widthFor(component, *cached);
+        if (!qFuzzyCompare(component->property("contentWidth").toReal(), width)) {
+            component->setProperty("contentWidth", width);
+        }
+    }
+}
+
+void TableColumnMeasurer::invalidate(const QList<int> &roles)
+{
+    bool changed = false;
+    for (auto it = m_textWidths.begin(); it != m_textWidths.end();) {
+        const Source source = Source::fromKey(it.key());
+        if (roles.isEmpty() || roles.contains(source.role) || (source.displayRoleFirst && roles.contains(Qt::DisplayRole))) {
+            it = m_textWidths.erase(it);
+            changed = true;
+        } else {
+            ++it;
+        }
+    }
+
+    // Measurements still running would store outdated widths.
+    if (changed || !m_measuring.isEmpty()) {
+        ++m_generation;
+    }
+    m_contentFitTimer.start();
+}
+
+#include "moc_tablecolumnmeasurer.cpp"
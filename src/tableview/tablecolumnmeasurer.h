@@ -0,0 +1,159 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QFont>
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QSet>
+#include <QThreadPool>
+#include <QTimer>
+
+class QAbstractItemModel;
+class TableColumnModel;
+
+/**
+ * @brief Measures how wide the text of a table column is, without creating any delegate.
+ *
+ * Only a bounded sample of rows is measured: the visible rows, plus the
+ * longest strings of the column by character count. Models are only read from
+ * the GUI thread, so at most a couple thousand rows, picked with a stride, are
+ * scanned to find those. The strings are measured with QFontMetricsF on a
+ * worker thread, and the result is kept until the data of the column changes.
+ *
+ * Columns whose header component has the ContentFit width policy get their
+ * contentWidth updated automatically.
+ */
+class TableColumnMeasurer : public QObject
+{
+    Q_OBJECT
+
+    /**
+     * @brief The model shown by the table, anything that is not a QAbstractItemModel is ignored.
+     */
+    Q_PROPERTY(QVariant model READ model WRITE setModel NOTIFY modelChanged)
+
+    Q_PROPERTY(TableColumnModel *columnModel READ columnModel WRITE setColumnModel NOTIFY columnModelChanged)
+
+    /**
+     * @brief The font the cells are drawn with.
+     */
+    Q_PROPERTY(QFont font READ font WRITE setFont NOTIFY fontChanged)
+
+    /**
+     * @brief Horizontal space added to the measured text, for the padding of the cells.
+     */
+    Q_PROPERTY(qreal padding READ padding WRITE setPadding NOTIFY paddingChanged)
+
+    /**
+     * @brief How many of the longest strings of a column are measured, default 32.
+     */
+    Q_PROPERTY(int sampleSize READ sampleSize WRITE setSampleSize NOTIFY sampleSizeChanged)
+
+    /**
+     * @brief The rows currently shown, always part of the sample.
+     */
+    Q_PROPERTY(int firstVisibleRow READ firstVisibleRow WRITE setFirstVisibleRow NOTIFY visibleRowsChanged)
+    Q_PROPERTY(int lastVisibleRow READ lastVisibleRow WRITE setLastVisibleRow NOTIFY visibleRowsChanged)
+
+    /**
+     * @brief Whether the cells show the display role of their column, falling
+     * back to the textRole of the header component, default false.
+     *
+     * Matches TableCellDelegate when true. Otherwise the textRole of the first
+     * model column is read, like ListCellDelegate does.
+     */
+    Q_PROPERTY(bool displayRoleFirst READ displayRoleFirst WRITE setDisplayRoleFirst NOTIFY displayRoleFirstChanged)
+
+public:
+    explicit TableColumnMeasurer(QObject *parent = nullptr);
+    ~TableColumnMeasurer() override;
+
+    QVariant model() const;
+    void setModel(const QVariant &model);
+
+    TableColumnModel *columnModel() const;
+    void setColumnModel(TableColumnModel *columnModel);
+
+    QFont font() const;
+    void setFont(const QFont &font);
+
+    qreal padding() const;
+    void setPadding(qreal padding);
+
+    int sampleSize() const;
+    void setSampleSize(int sampleSize);
+
+    int firstVisibleRow() const;
+    void setFirstVisibleRow(int firstVisibleRow);
+
+    int lastVisibleRow() const;
+    void setLastVisibleRow(int lastVisibleRow);
+
+    bool displayRoleFirst() const;
+    void setDisplayRoleFirst(bool displayRoleFirst);
+
+    /**
+     * @brief Resizes @p column of the column model to fit its contents.
+     *
+     * Immediate when the column was measured already, otherwise done once the
+     * measurement is over.
+     */
+    Q_INVOKABLE void fitColumn(int column);
+
+Q_SIGNALS:
+    void modelChanged();
+    void columnModelChanged();
+    void fontChanged();
+    void paddingChanged();
+    void sampleSizeChanged();
+    void visibleRowsChanged();
+    void displayRoleFirstChanged();
+
+private:
+    // Where the text of a column comes from: the display role of a model
+    // column then the text role, or only the text role.
+    struct Source {
+        int column = 0;
+        int role = -1; // the text role, -1 without one
+        bool displayRoleFirst = false;
+
+        quint64 key() const
+        {
+            return (quint64(quint32(column)) << 33) | (quint64(displayRoleFirst) << 32) | quint32(role);
+        }
+        static Source fromKey(quint64 key)
+        {
+            return {int(key >> 33), int(quint32(key)), bool((key >> 32) & 1)};
+        }
+    };
+
+    Source sourceFor(const QObject *component, int column) const;
+    qreal widthFor(const QObject *component, qreal textWidth) const;
+    void measure(const Source &source);
+    void applyResult(quint64 generation, quint64 key, qreal textWidth);
+    void updateContentFitColumns();
+    void invalidate(const QList<int> &roles = {});
+
+    QPointer<QAbstractItemModel> m_model;
+    QPointer<TableColumnModel> m_columnModel;
+    QFont m_font;
+    qreal m_padding = 0;
+    int m_sampleSize = 32;
+    int m_firstVisibleRow = 0;
+    int m_lastVisibleRow = -1;
+    bool m_displayRoleFirst = false;
+
+    QThreadPool m_pool;
+    QTimer m_contentFitTimer; // coalesces the automatic measurements
+    quint64 m_generation = 0; // bumped whenever cached widths are dropped
+    QHash<quint64, qreal> m_textWidths;
+    QSet<quint64> m_measuring;
+    QList<QPointer<QObject>> m_fitRequests;
+};
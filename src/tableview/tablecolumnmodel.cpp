@@ -0,0 +1,495 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "tablecolumnmodel.h"
+
+#include <KConfigGroup>
+#include <KSharedConfig>
+
+#include <QMetaProperty>
+
+#include <algorithm>
+#include <numeric>
+
+TableColumnModel::TableColumnModel(QObject *parent)
+    : QAbstractListModel(parent)
+    , m_offsets({0})
+{
+}
+
+QList<QObject *> TableColumnModel::headerComponents() const
+{
+    QList<QObject *> components;
+    components.reserve(m_headerComponents.size());
+    for (const auto &component : m_headerComponents) {
+        if (component) {
+            components.append(component);
+        }
+    }
+    return components;
+}
+
+void TableColumnModel::setHeaderComponents(const QList<QObject *> &headerComponents)
+{
+    for (const auto &component : std::as_const(m_headerComponents)) {
+        if (component) {
+            disconnect(component, nullptr, this, nullptr);
+        }
+    }
+
+    m_headerComponents.clear();
+    m_resizedWidths.clear();
+    for (QObject *component : headerComponents) {
+        // Ignore anything that is not a header component, like the QML version did.
+        if (!component || component->metaObject()->indexOfProperty("headerDelegate") < 0) {
+            continue;
+        }
+        m_headerComponents.append(component);
+        connectComponent(component);
+    }
+
+    beginResetModel();
+    m_order.resize(m_headerComponents.size());
+    std::iota(m_order.begin(), m_order.end(), 0);
+    loadColumnOrder();
+    m_columns = visibleColumns();
+    endResetModel();
+
+    updateGeometry();
+    Q_EMIT countChanged();
+    Q_EMIT headerComponentsChanged();
+    Q_EMIT columnOrderChanged();
+}
+
+QList<int> TableColumnModel::columnOrder() const
+{
+    return m_order;
+}
+
+void TableColumnModel::setColumnOrder(const QList<int> &columnOrder)
+{
+    // Only a permutation of the logical indexes makes sense.
+    QList<int> sorted = columnOrder;
+    std::sort(sorted.begin(), sorted.end());
+    for (int i = 0; i < sorted.size(); ++i) {
+        if (sorted.at(i) != i) {
+            return;
+        }
+    }
+    if (columnOrder.size() != m_headerComponents.size() || columnOrder == m_order) {
+        return;
+    }
+
+    beginResetModel();
+    m_order = columnOrder;
+    m_columns = visibleColumns();
+    endResetModel();
+
+    updateGeometry();
+    saveColumnOrder();
+    Q_EMIT columnOrderChanged();
+}
+
+QList<int> TableColumnModel::logicalColumns() const
+{
+    QList<int> columns;
+    columns.reserve(m_columns.size());
+    for (const QObject *component : std::as_const(m_columns)) {
+        columns.append(logicalIndexOf(component));
+    }
+    return columns;
+}
+
+bool TableColumnModel::isReordered() const
+{
+    const QList<int> columns = logicalColumns();
+    if (columns.size() != m_headerComponents.size()) {
+        return true;
+    }
+    for (int column = 0; column < columns.size(); ++column) {
+        if (columns.at(column) != column) {
+            return true;
+        }
+    }
+    return false;
+}
+
+QString TableColumnModel::configGroup() const
+{
+    return m_configGroup;
+}
+
+void TableColumnModel::setConfigGroup(const QString &configGroup)
+{
+    if (m_configGroup == configGroup) {
+        return;
+    }
+    m_configGroup = configGroup;
+
+    const QList<int> order = m_order;
+    loadColumnOrder();
+    if (m_order != order) {
+        beginResetModel();
+        m_columns = visibleColumns();
+        endResetModel();
+        updateGeometry();
+        Q_EMIT columnOrderChanged();
+    }
+    Q_EMIT configGroupChanged();
+}
+
+QList<QObject *> TableColumnModel::visibleColumns() const
+{
+    QList<QObject *> columns;
+    for (int logical : std::as_const(m_order)) {
+        QObject *component = m_headerComponents.value(logical);
+        if (component && component->property("visible").toBool()) {
+            columns.append(component);
+        }
+    }
+    return columns;
+}
+
+int TableColumnModel::logicalIndexOf(const QObject *component) const
+{
+    for (int logical = 0; logical < m_headerComponents.size(); ++logical) {
+        if (m_headerComponents.at(logical) == component) {
+            return logical;
+        }
+    }
+    return -1;
+}
+
+void TableColumnModel::loadColumnOrder()
+{
+    if (m_configGroup.isEmpty()) {
+        return;
+    }
+
+    const KConfigGroup group(KSharedConfig::openConfig(), m_configGroup);
+    const QList<int> order = group.readEntry("ColumnOrder", QList<int>());
+
+    // Ignore orders saved for another set of columns.
+    QList<int> sorted = order;
+    std::sort(sorted.begin(), sorted.end());
+    if (sorted.size() != m_headerComponents.size()) {
+        return;
+    }
+    for (int i = 0; i < sorted.size(); ++i) {
+        if (sorted.at(i) != i) {
+            return;
+        }
+    }
+    m_order = order;
+}
+
+void TableColumnModel::saveColumnOrder() const
+{
+    if (m_configGroup.isEmpty()) {
+        return;
+    }
+
+    KConfigGroup group(KSharedConfig::openConfig(), m_configGroup);
+    group.writeEntry("ColumnOrder", m_order);
+    group.sync();
+}
+
+void TableColumnModel::connectComponent(QObject *component)
+{
+    const QMetaObject *metaObject = component->metaObject();
+    const QMetaMethod updateColumnsSlot = staticMetaObject.method(staticMetaObject.indexOfSlot("updateColumns()"));
+    const QMetaMethod updateGeometrySlot = staticMetaObject.method(staticMetaObject.indexOfSlot("updateGeometry()"));
+
+    const QMetaProperty visible = metaObject->property(metaObject->indexOfProperty("visible"));
+    if (visible.hasNotifySignal()) {
+        connect(component, visible.notifySignal(), this, updateColumnsSlot);
+    }
+    for (const char *name : {"width", "minimumWidth", "widthPolicy", "stretchFactor", "contentWidth"}) {
+        const int index = metaObject->indexOfProperty(name);
+        if (index >= 0 && metaObject->property(index).hasNotifySignal()) {
+            connect(component, metaObject->property(index).notifySignal(), this, updateGeometrySlot);
+        }
+    }
+    connect(component, &QObject::destroyed, this, &TableColumnModel::updateColumns);
+}
+
+qreal TableColumnModel::contentWidth() const
+{
+    return m_offsets.constLast();
+}
+
+qreal TableColumnModel::availableWidth() const
+{
+    return m_availableWidth;
+}
+
+void TableColumnModel::setAvailableWidth(qreal availableWidth)
+{
+    if (qFuzzyCompare(m_availableWidth, availableWidth)) {
+        return;
+    }
+    m_availableWidth = availableWidth;
+    updateGeometry();
+    Q_EMIT availableWidthChanged();
+}
+
+int TableColumnModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_columns.size();
+}
+
+QVariant TableColumnModel::data(const QModelIndex &index, int role) const
+{
+    if (!checkIndex(index, QAbstractItemModel::CheckIndexOption::IndexIsValid)) {
+        return {};
+    }
+
+    switch (role) {
+    case HeaderComponentRole:
+        return QVariant::fromValue(m_columns.at(index.row()));
+    case ColumnWidthRole:
+        return columnWidth(index.row());
+    case ColumnOffsetRole:
+        return columnOffset(index.row());
+    }
+
+    return {};
+}
+
+QHash<int, QByteArray> TableColumnModel::roleNames() const
+{
+    return {
+        {HeaderComponentRole, QByteArrayLiteral("headerComponent")},
+        {ColumnWidthRole, QByteArrayLiteral("columnWidth")},
+        {ColumnOffsetRole, QByteArrayLiteral("columnOffset")},
+    };
+}
+
+int TableColumnModel::logicalIndex(int column) const
+{
+    return logicalIndexOf(m_columns.value(column));
+}
+
+int TableColumnModel::visualIndex(int logicalIndex) const
+{
+    return m_columns.indexOf(m_headerComponents.value(logicalIndex));
+}
+
+QObject *TableColumnModel::headerComponentAt(int column) const
+{
+    return m_columns.value(column);
+}
+
+qreal TableColumnModel::columnWidth(int column) const
+{
+    if (column < 0 || column >= m_columns.size()) {
+        return 0;
+    }
+    return m_offsets.at(column + 1) - m_offsets.at(column);
+}
+
+qreal TableColumnModel::columnOffset(int column) const
+{
+    return m_offsets.value(column, 0);
+}
+
+int TableColumnModel::columnAt(qreal x) const
+{
+    if (m_columns.isEmpty() || x < 0 || x >= contentWidth()) {
+        return -1;
+    }
+    // First offset past x, the column starts right before it.
+    const auto it = std::upper_bound(m_offsets.cbegin(), m_offsets.cend(), x);
+    return int(std::distance(m_offsets.cbegin(), it)) - 1;
+}
+
+void TableColumnModel::resizeColumn(int column, qreal width)
+{
+    QObject *component = m_columns.value(column);
+    if (!component || !component->property("resizable").toBool()) {
+        return;
+    }
+
+    width = std::max(width, component->property("minimumWidth").toReal());
+    // Fixed columns follow their width anyway, and must keep following it when set later on.
+    if (component->property("widthPolicy").toInt() == Fixed) {
+        m_resizedWidths.remove(component);
+    } else {
+        m_resizedWidths.insert(component, width);
+    }
+    // Updates the geometry through the notify signal, or below when unchanged.
+    component->setProperty("width", width);
+    updateGeometry();
+}
+
+void TableColumnModel::move(int from, int to, int count)
+{
+    if (count <= 0 || from == to || from < 0 || to < 0 || from + count > m_columns.size() || to + count > m_columns.size()) {
+        return;
+    }
+
+    // Qt's destination is the row before which the block is inserted, in pre-move numbering.
+    if (!beginMoveRows({}, from, from + count - 1, {}, to > from ? to + count : to)) {
+        return;
+    }
+
+    QList<QObject *> block = m_columns.mid(from, count);
+    m_columns.remove(from, count);
+    for (int i = 0; i < count; ++i) {
+        m_columns.insert(to + i, block.at(i));
+    }
+
+    // Update the full order the same way, so that hiding a column does not undo the move.
+    auto visible = m_columns.cbegin();
+    for (int &logical : m_order) {
+        const QObject *component = m_headerComponents.value(logical);
+        if (component && component->property("visible").toBool() && visible != m_columns.cend()) {
+            logical = logicalIndexOf(*visible++);
+        }
+    }
+
+    endMoveRows();
+
+    updateGeometry();
+    saveColumnOrder();
+    Q_EMIT columnOrderChanged();
+}
+
+void TableColumnModel::updateColumns()
+{
+    const QList<QObject *> columns = visibleColumns();
+
+    for (auto it = m_resizedWidths.begin(); it != m_resizedWidths.end();) {
+        const bool known = std::any_of(m_headerComponents.cbegin(), m_headerComponents.cend(), [&it](const QPointer<QObject> &component) {
+            return component == it.key();
+        });
+        it = known ? std::next(it) : m_resizedWidths.erase(it);
+    }
+
+    if (columns == m_columns) {
+        updateGeometry();
+        return;
+    }
+
+    const bool countChanged = columns.size() != m_columns.size();
+    beginResetModel();
+    m_columns = columns;
+    endResetModel();
+
+    updateGeometry();
+    if (countChanged) {
+        Q_EMIT this->countChanged();
+    }
+    // The visible columns changed, and so did their logical indexes.
+    Q_EMIT columnOrderChanged();
+}
+
+QList<qreal> TableColumnModel::computeWidths() const
+{
+    QList<qreal> widths(m_columns.size(), 0);
+    QList<int> stretched;
+    qreal usedWidth = 0;
+    qreal totalFactor = 0;
+
+    for (int column = 0; column < m_columns.size(); ++column) {
+        const QObject *component = m_columns.at(column);
+        const qreal width = component->property("width").toReal();
+        const qreal minimumWidth = component->property("minimumWidth").toReal();
+
+        const auto resized = m_resizedWidths.constFind(component);
+        if (resized != m_resizedWidths.cend()) {
+            widths[column] = *resized;
+            usedWidth += *resized;
+            continue;
+        }
+
+        switch (component->property("widthPolicy").toInt()) {
+        case Minimum:
+            widths[column] = minimumWidth;
+            break;
+        case Stretch: {
+            const qreal factor = component->property("stretchFactor").toReal();
+            if (m_availableWidth > 0 && factor > 0) {
+                stretched.append(column);
+                totalFactor += factor;
+                continue;
+            }
+            widths[column] = std::max(width, minimumWidth);
+            break;
+        }
+        case ContentFit: {
+            const qreal contentWidth = component->property("contentWidth").toReal();
+            widths[column] = contentWidth > 0 ? std::max(contentWidth, minimumWidth) : width;
+            break;
+        }
+        default:
+            widths[column] = width;
+            break;
+        }
+        usedWidth += widths[column];
+    }
+
+    // Share what is left by factor. A column that would get less than its minimum gets the
+    // minimum and leaves the share, so the others are computed again without it.
+    qreal remaining = std::max<qreal>(m_availableWidth - usedWidth, 0);
+    bool clamped = true;
+    while (clamped && !stretched.isEmpty()) {
+        clamped = false;
+        for (auto it = stretched.begin(); it != stretched.end(); ++it) {
+            const QObject *component = m_columns.at(*it);
+            const qreal factor = component->property("stretchFactor").toReal();
+            const qreal minimumWidth = component->property("minimumWidth").toReal();
+            if (remaining * factor / totalFactor < minimumWidth) {
+                widths[*it] = minimumWidth;
+                remaining = std::max<qreal>(remaining - minimumWidth, 0);
+                totalFactor -= factor;
+                stretched.erase(it);
+                clamped = true;
+                break;
+            }
+        }
+    }
+    for (int column : std::as_const(stretched)) {
+        widths[column] = remaining * m_columns.at(column)->property("stretchFactor").toReal() / totalFactor;
+    }
+
+    return widths;
+}
+
+void TableColumnModel::updateGeometry()
+{
+    const QList<qreal> widths = computeWidths();
+    QList<qreal> offsets;
+    offsets.reserve(m_columns.size() + 1);
+    offsets.append(0);
+    for (qreal width : widths) {
+        offsets.append(offsets.constLast() + width);
+    }
+
+    if (offsets == m_offsets) {
+        return;
+    }
+
+    // Only notify the columns whose geometry moved.
+    int first = 0;
+    const int common = int(std::min(offsets.size(), m_offsets.size()));
+    while (first + 1 < common && offsets.at(first) == m_offsets.at(first) && offsets.at(first + 1) == m_offsets.at(first + 1)) {
+        ++first;
+    }
+
+    const bool contentWidthChanged = offsets.constLast() != m_offsets.constLast();
+    m_offsets = offsets;
+
+    if (!m_columns.isEmpty() && first < m_columns.size()) {
+        Q_EMIT dataChanged(index(first), index(m_columns.size() - 1), {ColumnWidthRole, ColumnOffsetRole});
+    }
+    if (contentWidthChanged) {
+        Q_EMIT this->contentWidthChanged();
+    }
+    Q_EMIT columnWidthsChanged();
+}
+
+#include "moc_tablecolumnmodel.cpp"
@@ -0,0 +1,185 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QAbstractListModel>
+#include <QHash>
+#include <QList>
+#include <QPointer>
+
+/**
+ * @brief The visible columns of a table, one row per AbstractHeaderComponent.
+ *
+ * Column widths, offsets and the total width are cached and only recomputed
+ * when a header component or availableWidth changes, so that delegates can
+ * look up the geometry of a column without going through JavaScript.
+ *
+ * Each header component picks how its width is computed through widthPolicy:
+ * - Fixed: the width of the component, the default.
+ * - Minimum: the minimumWidth of the component.
+ * - Stretch: a share of the width left by the other columns, in proportion
+ *   to stretchFactor and never below minimumWidth.
+ * - ContentFit: the contentWidth of the component, falling back to its width
+ *   while the contents were not measured.
+ *
+ * A column resized by the user through resizeColumn() keeps that width
+ * whatever its policy.
+ *
+ * The logical index of a column is its position in headerComponents, which
+ * never changes. Moving columns only changes the visual order, kept in
+ * columnOrder and saved to the application config when configGroup is set.
+ */
+class TableColumnModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+    /**
+     * @brief All the header components of the table, including invisible ones.
+     */
+    Q_PROPERTY(QList<QObject *> headerComponents READ headerComponents WRITE setHeaderComponents NOTIFY headerComponentsChanged)
+
+    /**
+     * @brief The logical indexes of all the columns, invisible ones included, in the order they are shown.
+     */
+    Q_PROPERTY(QList<int> columnOrder READ columnOrder WRITE setColumnOrder NOTIFY columnOrderChanged)
+
+    /**
+     * @brief The logical index of each visible column, in the order they are shown.
+     */
+    Q_PROPERTY(QList<int> logicalColumns READ logicalColumns NOTIFY columnOrderChanged)
+
+    /**
+     * @brief Whether logicalColumns differs from all the columns in their logical order,
+     * because columns were moved or some are invisible.
+     */
+    Q_PROPERTY(bool reordered READ isReordered NOTIFY columnOrderChanged)
+
+    /**
+     * @brief The group of the application config the column order is saved to, nothing is saved when empty.
+     */
+    Q_PROPERTY(QString configGroup READ configGroup WRITE setConfigGroup NOTIFY configGroupChanged)
+
+    /**
+     * @brief The number of visible columns.
+     */
+    Q_PROPERTY(int count READ rowCount NOTIFY countChanged)
+
+    /**
+     * @brief The sum of the widths of the visible columns.
+     */
+    Q_PROPERTY(qreal contentWidth READ contentWidth NOTIFY contentWidthChanged)
+
+    /**
+     * @brief The width shared by the columns with the Stretch policy, usually the width of the view.
+     */
+    Q_PROPERTY(qreal availableWidth READ availableWidth WRITE setAvailableWidth NOTIFY availableWidthChanged)
+
+public:
+    enum WidthPolicy {
+        Fixed,
+        Minimum,
+        Stretch,
+        ContentFit,
+    };
+    Q_ENUM(WidthPolicy)
+
+    enum Roles {
+        HeaderComponentRole = Qt::UserRole + 1,
+        ColumnWidthRole,
+        ColumnOffsetRole,
+    };
+    Q_ENUM(Roles)
+
+    explicit TableColumnModel(QObject *parent = nullptr);
+
+    QList<QObject *> headerComponents() const;
+    void setHeaderComponents(const QList<QObject *> &headerComponents);
+
+    QList<int> columnOrder() const;
+    void setColumnOrder(const QList<int> &columnOrder);
+
+    QList<int> logicalColumns() const;
+    bool isReordered() const;
+
+    QString configGroup() const;
+    void setConfigGroup(const QString &configGroup);
+
+    qreal contentWidth() const;
+
+    qreal availableWidth() const;
+    void setAvailableWidth(qreal availableWidth);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    Q_INVOKABLE QObject *headerComponentAt(int column) const;
+    Q_INVOKABLE qreal columnWidth(int column) const;
+    Q_INVOKABLE qreal columnOffset(int column) const;
+
+    /**
+     * @brief The visible column at the horizontal position @p x, or -1.
+     */
+    Q_INVOKABLE int columnAt(qreal x) const;
+
+    /**
+     * @brief Gives @p column the width the user dragged it to, if it is resizable.
+     *
+     * The width is also written back to the header component.
+     */
+    Q_INVOKABLE void resizeColumn(int column, qreal width);
+
+    /**
+     * @brief The logical index of the visible column @p column, or -1.
+     */
+    Q_INVOKABLE int logicalIndex(int column) const;
+
+    /**
+     * @brief The visible column showing the logical column @p logicalIndex, or -1 when it is hidden.
+     */
+    Q_INVOKABLE int visualIndex(int logicalIndex) const;
+
+    /**
+     * @brief Moves @p count columns from @p from to @p to, like ListModel.move().
+     *
+     * Only the visual order changes, the logical indexes stay the same.
+     */
+    Q_INVOKABLE void move(int from, int to, int count = 1);
+
+Q_SIGNALS:
+    void headerComponentsChanged();
+    void columnOrderChanged();
+    void configGroupChanged();
+    void countChanged();
+    void contentWidthChanged();
+    void availableWidthChanged();
+
+    /**
+     * @brief Emitted once the width of one or more columns changed.
+     */
+    void columnWidthsChanged();
+
+private Q_SLOTS:
+    void updateColumns();
+    void updateGeometry();
+
+private:
+    void connectComponent(QObject *component);
+    QList<QObject *> visibleColumns() const;
+    int logicalIndexOf(const QObject *component) const;
+    void loadColumnOrder();
+    void saveColumnOrder() const;
+    QList<qreal> computeWidths() const;
+
+    QList<QPointer<QObject>> m_headerComponents;
+    QList<int> m_order; // logical indexes in display order, invisible ones included
+    QList<QObject *> m_columns; // visible components, in display order
+    QString m_configGroup;
+    QList<qreal> m_offsets; // m_columns.size() + 1 entries, the last one is the content width
+    QHash<QObject *, qreal> m_resizedWidths; // widths set by the user, whatever the policy
+    qreal m_availableWidth = 0;
+};
@@ -0,0 +1,370 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "tablecolumnorderproxymodel.h"
+
+#include <algorithm>
+#include <utility>
+
+TableColumnOrderProxyModel::TableColumnOrderProxyModel(QObject *parent)
+    : QAbstractProxyModel(parent)
+{
+}
+
+QVariant TableColumnOrderProxyModel::model() const
+{
+    return QVariant::fromValue(sourceModel());
+}
+
+void TableColumnOrderProxyModel::setModel(const QVariant &model)
+{
+    setSourceModel(qobject_cast<QAbstractItemModel *>(model.value<QObject *>()));
+}
+
+QList<int> TableColumnOrderProxyModel::columns() const
+{
+    return m_columns;
+}
+
+void TableColumnOrderProxyModel::setColumns(const QList<int> &columns)
+{
+    if (m_columns == columns) {
+        return;
+    }
+
+    m_columns = columns;
+    if (m_resetting || !sourceModel()) {
+        rebuildMapping();
+        Q_EMIT columnsChanged();
+        return;
+    }
+
+    // Rows stay where they are, only the columns of the indexes views hold change.
+    Q_EMIT layoutAboutToBeChanged({}, QAbstractItemModel::NoLayoutChangeHint);
+
+    const QModelIndexList proxyIndexes = persistentIndexList();
+    QModelIndexList sourceIndexes;
+    sourceIndexes.reserve(proxyIndexes.size());
+    for (const QModelIndex &proxyIndex : proxyIndexes) {
+        sourceIndexes.append(mapToSource(proxyIndex));
+    }
+
+    rebuildMapping();
+
+    QModelIndexList newIndexes;
+    newIndexes.reserve(sourceIndexes.size());
+    for (const QModelIndex &sourceIndex : std::as_const(sourceIndexes)) {
+        newIndexes.append(mapFromSource(sourceIndex));
+    }
+    changePersistentIndexList(proxyIndexes, newIndexes);
+
+    Q_EMIT layoutChanged({}, QAbstractItemModel::NoLayoutChangeHint);
+    Q_EMIT columnsChanged();
+}
+
+void TableColumnOrderProxyModel::setSourceModel(QAbstractItemModel *sourceModel)
+{
+    if (sourceModel == this->sourceModel()) {
+        return;
+    }
+
+    beginResetModel();
+
+    for (const auto &connection : std::as_const(m_sourceConnections)) {
+        disconnect(connection);
+    }
+    m_sourceConnections.clear();
+
+    QAbstractProxyModel::setSourceModel(sourceModel);
+
+    if (sourceModel) {
+        m_sourceConnections = {
+            connect(sourceModel, &QAbstractItemModel::dataChanged, this, &TableColumnOrderProxyModel::sourceDataChanged),
+            connect(sourceModel, &QAbstractItemModel::headerDataChanged, this, &TableColumnOrderProxyModel::sourceHeaderDataChanged),
+            // Rows map one to one, so row changes go through as they are.
+            connect(sourceModel,
+                    &QAbstractItemModel::rowsAboutToBeInserted,
+                    this,
+                    [this](const QModelIndex &parent, int first, int last) {
+                        if (!parent.isValid()) {
+                            beginInsertRows({}, first, last);
+                        }
+                    }),
+            connect(sourceModel,
+                    &QAbstractItemModel::rowsInserted,
+                    this,
+                    [this](const QModelIndex &parent) {
+                        if (!parent.isValid()) {
+                            endInsertRows();
+                        }
+                    }),
+            connect(sourceModel,
+                    &QAbstractItemModel::rowsAboutToBeRemoved,
+                    this,
+                    [this](const QModelIndex &parent, int first, int last) {
+                        if (!parent.isValid()) {
+                            beginRemoveRows({}, first, last);
+                        }
+                    }),
+            connect(sourceModel,
+                    &QAbstractItemModel::rowsRemoved,
+                    this,
+                    [this](const QModelIndex &parent) {
+                        if (!parent.isValid()) {
+                            endRemoveRows();
+                        }
+                    }),
+            connect(sourceModel, &QAbstractItemModel::rowsAboutToBeMoved, this, &TableColumnOrderProxyModel::sourceRowsAboutToBeMoved),
+            connect(sourceModel, &QAbstractItemModel::rowsMoved, this, &TableColumnOrderProxyModel::sourceRowsMoved),
+            connect(sourceModel, &QAbstractItemModel::layoutAboutToBeChanged, this, &TableColumnOrderProxyModel::sourceLayoutAboutToBeChanged),
+            connect(sourceModel, &QAbstractItemModel::layoutChanged, this, &TableColumnOrderProxyModel::sourceLayoutChanged),
+            // Anything changing the columns is rare enough to be handled as a reset.
+            connect(sourceModel, &QAbstractItemModel::modelAboutToBeReset, this, &TableColumnOrderProxyModel::sourceAboutToBeReset),
+            connect(sourceModel, &QAbstractItemModel::modelReset, this, &TableColumnOrderProxyModel::sourceReset),
+            connect(sourceModel, &QAbstractItemModel::columnsAboutToBeInserted, this, &TableColumnOrderProxyModel::sourceAboutToBeReset),
+            connect(sourceModel, &QAbstractItemModel::columnsInserted, this, &TableColumnOrderProxyModel::sourceReset),
+            connect(sourceModel, &QAbstractItemModel::columnsAboutToBeRemoved, this, &TableColumnOrderProxyModel::sourceAboutToBeReset),
+            connect(sourceModel, &QAbstractItemModel::columnsRemoved, this, &TableColumnOrderProxyModel::sourceReset),
+            connect(sourceModel, &QAbstractItemModel::columnsAboutToBeMoved, this, &TableColumnOrderProxyModel::sourceAboutToBeReset),
+            connect(sourceModel, &QAbstractItemModel::columnsMoved, this, &TableColumnOrderProxyModel::sourceReset),
+        };
+    }
+
+    rebuildMapping();
+
+    endResetModel();
+}
+
+QModelIndex TableColumnOrderProxyModel::index(int row, int column, const QModelIndex &parent) const
+{
+    if (parent.isValid() || row < 0 || row >= rowCount() || column < 0 || column >= columnCount()) {
+        return {};
+    }
+    return createIndex(row, column);
+}
+
+QModelIndex TableColumnOrderProxyModel::parent(const QModelIndex &child) const
+{
+    Q_UNUSED(child)
+    return {};
+}
+
+int TableColumnOrderProxyModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid() || !sourceModel()) {
+        return 0;
+    }
+    return sourceModel()->rowCount();
+}
+
+int TableColumnOrderProxyModel::columnCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+    return m_proxyToSource.size();
+}
+
+bool TableColumnOrderProxyModel::hasChildren(const QModelIndex &parent) const
+{
+    return !parent.isValid() && rowCount() > 0 && columnCount() > 0;
+}
+
+QModelIndex TableColumnOrderProxyModel::sibling(int row, int column, const QModelIndex &index) const
+{
+    Q_UNUSED(index)
+    return this->index(row, column);
+}
+
+QModelIndex TableColumnOrderProxyModel::mapToSource(const QModelIndex &proxyIndex) const
+{
+    if (!proxyIndex.isValid() || !sourceModel() || proxyIndex.column() >= m_proxyToSource.size()) {
+        return {};
+    }
+    return sourceModel()->index(proxyIndex.row(), m_proxyToSource.at(proxyIndex.column()));
+}
+
+QModelIndex TableColumnOrderProxyModel::mapFromSource(const QModelIndex &sourceIndex) const
+{
+    if (!sourceIndex.isValid() || sourceIndex.parent().isValid() || sourceIndex.column() >= m_sourceToProxy.size()) {
+        return {};
+    }
+    const int column = m_sourceToProxy.at(sourceIndex.column());
+    return column < 0 ? QModelIndex() : index(sourceIndex.row(), column);
+}
+
+QVariant TableColumnOrderProxyModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (!sourceModel()) {
+        return {};
+    }
+    if (orientation == Qt::Horizontal) {
+        if (section < 0 || section >= m_proxyToSource.size()) {
+            return {};
+        }
+        section = m_proxyToSource.at(section);
+    }
+    return sourceModel()->headerData(section, orientation, role);
+}
+
+void TableColumnOrderProxyModel::rebuildMapping()
+{
+    const int sourceColumns = sourceModel() ? sourceModel()->columnCount() : 0;
+
+    m_proxyToSource.clear();
+    if (m_columns.isEmpty()) {
+        for (int column = 0; column < sourceColumns; ++column) {
+            m_proxyToSource.append(column);
+        }
+    } else {
+        for (int column : std::as_const(m_columns)) {
+            if (column >= 0 && column < sourceColumns && !m_proxyToSource.contains(column)) {
+                m_proxyToSource.append(column);
+            }
+        }
+    }
+
+    m_sourceToProxy.fill(-1, sourceColumns);
+    for (int column = 0; column < m_proxyToSource.size(); ++column) {
+        m_sourceToProxy[m_proxyToSource.at(column)] = column;
+    }
+}
+
+void TableColumnOrderProxyModel::sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QList<int> &roles)
+{
+    if (topLeft.parent().isValid() || columnCount() == 0) {
+        return;
+    }
+
+    // Reordered columns may not be next to each other anymore, so each run of them is signalled on its own.
+    QList<int> columns;
+    for (int column = topLeft.column(); column <= bottomRight.column() && column < m_sourceToProxy.size(); ++column) {
+        if (m_sourceToProxy.at(column) >= 0) {
+            columns.append(m_sourceToProxy.at(column));
+        }
+    }
+    std::sort(columns.begin(), columns.end());
+
+    for (qsizetype first = 0; first < columns.size();) {
+        qsizetype last = first;
+        while (last + 1 < columns.size() && columns.at(last + 1) == columns.at(last) + 1) {
+            ++last;
+        }
+        Q_EMIT dataChanged(index(topLeft.row(), columns.at(first)), index(bottomRight.row(), columns.at(last)), roles);
+        first = last + 1;
+    }
+}
+
+void TableColumnOrderProxyModel::sourceHeaderDataChanged(Qt::Orientation orientation, int first, int last)
+{
+    if (orientation == Qt::Vertical) {
+        Q_EMIT headerDataChanged(orientation, first, last);
+    } else if (columnCount() > 0) {
+        Q_EMIT headerDataChanged(orientation, 0, columnCount() - 1);
+    }
+}
+
+void TableColumnOrderProxyModel::sourceRowsAboutToBeMoved(const QModelIndex &sourceParent,
+                                                          int sourceStart,
+                                                          int sourceEnd,
+                                                          const QModelIndex &destinationParent,
+                                                          int destinationRow)
+{
+    // Child rows are not shown, so moves into or out of them are removals or insertions.
+    if (!sourceParent.isValid() && !destinationParent.isValid()) {
+        m_pendingMove = MoveRows;
+        beginMoveRows({}, sourceStart, sourceEnd, {}, destinationRow);
+    } else if (!sourceParent.isValid()) {
+        m_pendingMove = RemoveRows;
+        beginRemoveRows({}, sourceStart, sourceEnd);
+    } else if (!destinationParent.isValid()) {
+        m_pendingMove = InsertRows;
+        beginInsertRows({}, destinationRow, destinationRow + sourceEnd - sourceStart);
+    } else {
+        m_pendingMove = NoMove;
+    }
+}
+
+void TableColumnOrderProxyModel::sourceRowsMoved()
+{
+    switch (std::exchange(m_pendingMove, NoMove)) {
+    case MoveRows:
+        endMoveRows();
+        break;
+    case RemoveRows:
+        endRemoveRows();
+        break;
+    case InsertRows:
+        endInsertRows();
+        break;
+    case NoMove:
+        break;
+    }
+}
+
+void TableColumnOrderProxyModel::sourceLayoutAboutToBeChanged(const QList<QPersistentModelIndex> &parents, QAbstractItemModel::LayoutChangeHint hint)
+{
+    // Only top level rows are shown, a change limited to child rows does not concern the proxy.
+    const bool topLevel = parents.isEmpty() || std::any_of(parents.cbegin(), parents.cend(), [](const QPersistentModelIndex &parent) {
+                              return !parent.isValid();
+                          });
+    m_layoutChanging = topLevel;
+    if (!topLevel) {
+        return;
+    }
+
+    Q_EMIT layoutAboutToBeChanged({}, hint);
+
+    // Remembered through the source, which moves its own persistent indexes.
+    m_layoutChangeProxyIndexes = persistentIndexList();
+    m_layoutChangeSourceIndexes.clear();
+    m_layoutChangeSourceIndexes.reserve(m_layoutChangeProxyIndexes.size());
+    for (const QModelIndex &proxyIndex : std::as_const(m_layoutChangeProxyIndexes)) {
+        m_layoutChangeSourceIndexes.append(mapToSource(proxyIndex));
+    }
+}
+
+void TableColumnOrderProxyModel::sourceLayoutChanged(const QList<QPersistentModelIndex> &parents, QAbstractItemModel::LayoutChangeHint hint)
+{
+    Q_UNUSED(parents)
+    if (!std::exchange(m_layoutChanging, false)) {
+        return;
+    }
+
+    QModelIndexList newIndexes;
+    newIndexes.reserve(m_layoutChangeSourceIndexes.size());
+    for (const QPersistentModelIndex &sourceIndex : std::as_const(m_layoutChangeSourceIndexes)) {
+        newIndexes.append(mapFromSource(sourceIndex));
+    }
+    changePersistentIndexList(m_layoutChangeProxyIndexes, newIndexes);
+    m_layoutChangeProxyIndexes.clear();
+    m_layoutChangeSourceIndexes.clear();
+
+    Q_EMIT layoutChanged({}, hint);
+}
+
+void TableColumnOrderProxyModel::sourceAboutToBeReset()
+{
+    if (m_resetting) {
+        return;
+    }
+    m_resetting = true;
+    beginResetModel();
+}
+
+void TableColumnOrderProxyModel::sourceReset()
+{
+    if (!m_resetting) {
+        return;
+    }
+
+    rebuildMapping();
+
+    m_resetting = false;
+    endResetModel();
+}
+
+#include "moc_tablecolumnorderproxymodel.cpp"
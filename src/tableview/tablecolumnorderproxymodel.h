@@ -0,0 +1,96 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QAbstractProxyModel>
+#include <QList>
+#include <QPersistentModelIndex>
+
+/**
+ * @brief Shows the columns of a flat table model in another order.
+ *
+ * Each proxy column shows the source column given at the same position in
+ * columns, so reordering or hiding columns only changes the mapping: rows are
+ * left alone and views get a layout change instead of a reset.
+ *
+ * Rows map one to one, so row insertions, removals, moves and layout changes
+ * of the source are forwarded as they are. Only changes to the columns of the
+ * source reset the proxy.
+ *
+ * Only top level rows are shown, child rows of tree models are not.
+ */
+class TableColumnOrderProxyModel : public QAbstractProxyModel
+{
+    Q_OBJECT
+
+    /**
+     * @brief The model to show, anything that is not a QAbstractItemModel is ignored.
+     */
+    Q_PROPERTY(QVariant model READ model WRITE setModel NOTIFY sourceModelChanged)
+
+    /**
+     * @brief The source column shown by each column, all of them in order when empty.
+     *
+     * Columns the source does not have are left out.
+     */
+    Q_PROPERTY(QList<int> columns READ columns WRITE setColumns NOTIFY columnsChanged)
+
+public:
+    explicit TableColumnOrderProxyModel(QObject *parent = nullptr);
+
+    QVariant model() const;
+    void setModel(const QVariant &model);
+
+    QList<int> columns() const;
+    void setColumns(const QList<int> &columns);
+
+    void setSourceModel(QAbstractItemModel *sourceModel) override;
+
+    QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override;
+    QModelIndex parent(const QModelIndex &child) const override;
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    bool hasChildren(const QModelIndex &parent = QModelIndex()) const override;
+    QModelIndex sibling(int row, int column, const QModelIndex &index) const override;
+    QModelIndex mapToSource(const QModelIndex &proxyIndex) const override;
+    QModelIndex mapFromSource(const QModelIndex &sourceIndex) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+Q_SIGNALS:
+    void columnsChanged();
+
+private:
+    void rebuildMapping();
+
+    void sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QList<int> &roles);
+    void sourceHeaderDataChanged(Qt::Orientation orientation, int first, int last);
+    void sourceRowsAboutToBeMoved(const QModelIndex &sourceParent, int sourceStart, int sourceEnd, const QModelIndex &destinationParent, int destinationRow);
+    void sourceRowsMoved();
+    void sourceLayoutAboutToBeChanged(const QList<QPersistentModelIndex> &parents, QAbstractItemModel::LayoutChangeHint hint);
+    void sourceLayoutChanged(const QList<QPersistentModelIndex> &parents, QAbstractItemModel::LayoutChangeHint hint);
+    void sourceAboutToBeReset();
+    void sourceReset();
+
+    QList<int> m_columns;
+    QList<int> m_proxyToSource; // m_columns without the columns the source does not have
+    QList<int> m_sourceToProxy; // -1 for source columns that are not shown
+    bool m_resetting = false;
+
+    // What the proxy began for a source move, top level rows moving to or from child rows.
+    enum PendingMove {
+        NoMove,
+        MoveRows,
+        RemoveRows,
+        InsertRows,
+    };
+    PendingMove m_pendingMove = NoMove;
+
+    bool m_layoutChanging = false;
+    QModelIndexList m_layoutChangeProxyIndexes;
+    QList<QPersistentModelIndex> m_layoutChangeSourceIndexes;
+    QList<QMetaObject::Connection> m_sourceConnections;
+};
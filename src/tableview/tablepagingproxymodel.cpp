@@ -0,0 +1,518 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "tablepagingproxymodel.h"
+
+#include <algorithm>
+
+namespace
+{
+bool canReleaseRows(const QAbstractItemModel *model)
+{
+    const QMetaObject *metaObject = model->metaObject();
+    return metaObject->indexOfMethod("releaseRows(int,int)") >= 0 && metaObject->indexOfMethod("fetchRows(int,int)") >= 0;
+}
+}
+
+TablePagingProxyModel::TablePagingProxyModel(QObject *parent)
+    : QIdentityProxyModel(parent)
+{
+    m_updateTimer.setSingleShot(true);
+    m_updateTimer.setInterval(0);
+    connect(&m_updateTimer, &QTimer::timeout, this, &TablePagingProxyModel::update);
+
+    m_fetchTimer.setSingleShot(true);
+    m_fetchTimer.setInterval(10000);
+    connect(&m_fetchTimer, &QTimer::timeout, this, [this] {
+        // Not asked again until the view moves, or update() would start it right over.
+        m_fetchFailed = true;
+        finishLoading();
+    });
+}
+
+QVariant TablePagingProxyModel::model() const
+{
+    return QVariant::fromValue(sourceModel());
+}
+
+void TablePagingProxyModel::setModel(const QVariant &model)
+{
+    setSourceModel(qobject_cast<QAbstractItemModel *>(model.value<QObject *>()));
+}
+
+int TablePagingProxyModel::firstVisibleRow() const
+{
+    return m_firstVisibleRow;
+}
+
+void TablePagingProxyModel::setFirstVisibleRow(int firstVisibleRow)
+{
+    if (m_firstVisibleRow == firstVisibleRow) {
+        return;
+    }
+    m_firstVisibleRow = firstVisibleRow;
+    m_fetchFailed = false;
+    m_updateTimer.start();
+    Q_EMIT visibleRowsChanged();
+}
+
+int TablePagingProxyModel::lastVisibleRow() const
+{
+    return m_lastVisibleRow;
+}
+
+void TablePagingProxyModel::setLastVisibleRow(int lastVisibleRow)
+{
+    if (m_lastVisibleRow == lastVisibleRow) {
+        return;
+    }
+    m_lastVisibleRow = lastVisibleRow;
+    m_fetchFailed = false;
+    m_updateTimer.start();
+    Q_EMIT visibleRowsChanged();
+}
+
+int TablePagingProxyModel::fetchAhead() const
+{
+    return m_fetchAhead;
+}
+
+void TablePagingProxyModel::setFetchAhead(int fetchAhead)
+{
+    if (m_fetchAhead == fetchAhead) {
+        return;
+    }
+    m_fetchAhead = fetchAhead;
+    m_updateTimer.start();
+    Q_EMIT fetchAheadChanged();
+}
+
+int TablePagingProxyModel::placeholderCount() const
+{
+    return m_placeholderCount;
+}
+
+void TablePagingProxyModel::setPlaceholderCount(int placeholderCount)
+{
+    if (m_placeholderCount == placeholderCount) {
+        return;
+    }
+    // Takes effect with the next fetch.
+    m_placeholderCount = std::max(placeholderCount, 0);
+    Q_EMIT placeholderCountChanged();
+}
+
+int TablePagingProxyModel::fetchTimeout() const
+{
+    return m_fetchTimer.interval();
+}
+
+void TablePagingProxyModel::setFetchTimeout(int fetchTimeout)
+{
+    if (m_fetchTimer.interval() == fetchTimeout) {
+        return;
+    }
+    m_fetchTimer.setInterval(fetchTimeout);
+    Q_EMIT fetchTimeoutChanged();
+}
+
+int TablePagingProxyModel::maximumResidentRows() const
+{
+    return m_maximumResidentRows;
+}
+
+void TablePagingProxyModel::setMaximumResidentRows(int maximumResidentRows)
+{
+    if (m_maximumResidentRows == maximumResidentRows) {
+        return;
+    }
+    m_maximumResidentRows = maximumResidentRows;
+
+    const bool releasing = m_maximumResidentRows > 0 && sourceModel() && canReleaseRows(sourceModel());
+    if (releasing && !m_releasing) {
+        m_rowStates.assign(sourceRowCount(), Resident);
+        m_residentCount = sourceRowCount();
+    } else if (!releasing && m_releasing) {
+        // Everything may be resident again.
+        const int rows = int(m_rowStates.size());
+        for (int row = 0; row < rows;) {
+            if (m_rowStates[row] != Released) {
+                ++row;
+                continue;
+            }
+            const int first = row;
+            while (row < rows && m_rowStates[row] == Released) {
+                ++row;
+            }
+            setRowStates(first, row - 1, Requested);
+            QMetaObject::invokeMethod(sourceModel(), "fetchRows", Q_ARG(int, first), Q_ARG(int, row - 1));
+        }
+        m_rowStates.clear();
+        m_residentCount = 0;
+    }
+    m_releasing = releasing;
+
+    m_updateTimer.start();
+    Q_EMIT maximumResidentRowsChanged();
+}
+
+bool TablePagingProxyModel::isLoading() const
+{
+    return m_loading;
+}
+
+void TablePagingProxyModel::setSourceModel(QAbstractItemModel *sourceModel)
+{
+    if (sourceModel == this->sourceModel()) {
+        return;
+    }
+
+    if (this->sourceModel()) {
+        disconnect(this->sourceModel(), &QAbstractItemModel::rowsInserted, this, &TablePagingProxyModel::sourceRowsInserted);
+        disconnect(this->sourceModel(), &QAbstractItemModel::rowsRemoved, this, &TablePagingProxyModel::sourceRowsRemoved);
+        disconnect(this->sourceModel(), &QAbstractItemModel::dataChanged, this, &TablePagingProxyModel::sourceDataChanged);
+        disconnect(this->sourceModel(), &QAbstractItemModel::layoutChanged, this, &TablePagingProxyModel::sourceLayoutChanged);
+        disconnect(this->sourceModel(), &QAbstractItemModel::modelAboutToBeReset, this, &TablePagingProxyModel::sourceAboutToBeReset);
+        disconnect(this->sourceModel(), &QAbstractItemModel::modelReset, this, &TablePagingProxyModel::sourceReset);
+    }
+
+    const bool wasLoading = m_loading;
+    beginResetModel();
+    QIdentityProxyModel::setSourceModel(sourceModel);
+    m_loading = false;
+    m_fetchFailed = false;
+    m_shownPlaceholders = 0;
+    m_fetchTimer.stop();
+    m_releasing = sourceModel && m_maximumResidentRows > 0 && canReleaseRows(sourceModel);
+    m_rowStates.assign(m_releasing ? sourceRowCount() : 0, Resident);
+    m_residentCount = int(m_rowStates.size());
+    endResetModel();
+
+    if (sourceModel) {
+        // Connected after QIdentityProxyModel, so the proxy already forwarded the change when these run.
+        connect(sourceModel, &QAbstractItemModel::rowsInserted, this, &TablePagingProxyModel::sourceRowsInserted);
+        connect(sourceModel, &QAbstractItemModel::rowsRemoved, this, &TablePagingProxyModel::sourceRowsRemoved);
+        connect(sourceModel, &QAbstractItemModel::dataChanged, this, &TablePagingProxyModel::sourceDataChanged);
+        connect(sourceModel, &QAbstractItemModel::layoutChanged, this, &TablePagingProxyModel::sourceLayoutChanged);
+        connect(sourceModel, &QAbstractItemModel::modelAboutToBeReset, this, &TablePagingProxyModel::sourceAboutToBeReset);
+        connect(sourceModel, &QAbstractItemModel::modelReset, this, &TablePagingProxyModel::sourceReset);
+    }
+
+    if (wasLoading) {
+        Q_EMIT loadingChanged();
+    }
+    m_updateTimer.start();
+}
+
+int TablePagingProxyModel::sourceRowCount() const
+{
+    return sourceModel() ? sourceModel()->rowCount() : 0;
+}
+
+bool TablePagingProxyModel::isPlaceholder(int row) const
+{
+    if (row >= sourceRowCount()) {
+        return true;
+    }
+    return m_releasing && size_t(row) < m_rowStates.size() && m_rowStates[row] != Resident;
+}
+
+QModelIndex TablePagingProxyModel::index(int row, int column, const QModelIndex &parent) const
+{
+    if (!parent.isValid() && row >= sourceRowCount() && row < rowCount() && column >= 0 && column < columnCount()) {
+        return createIndex(row, column);
+    }
+    return QIdentityProxyModel::index(row, column, parent);
+}
+
+QModelIndex TablePagingProxyModel::parent(const QModelIndex &child) const
+{
+    // Only flat models are paged, placeholder rows always are top level.
+    if (child.isValid() && !child.internalPointer() && child.row() >= sourceRowCount()) {
+        return {};
+    }
+    return QIdentityProxyModel::parent(child);
+}
+
+QModelIndex TablePagingProxyModel::sibling(int row, int column, const QModelIndex &idx) const
+{
+    if (idx.isValid() && !idx.parent().isValid()) {
+        return index(row, column);
+    }
+    return QIdentityProxyModel::sibling(row, column, idx);
+}
+
+int TablePagingProxyModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return QIdentityProxyModel::rowCount(parent);
+    }
+    return sourceRowCount() + m_shownPlaceholders;
+}
+
+QModelIndex TablePagingProxyModel::mapToSource(const QModelIndex &proxyIndex) const
+{
+    if (proxyIndex.isValid() && !proxyIndex.internalPointer() && proxyIndex.row() >= sourceRowCount()) {
+        return {};
+    }
+    return QIdentityProxyModel::mapToSource(proxyIndex);
+}
+
+QVariant TablePagingProxyModel::data(const QModelIndex &index, int role) const
+{
+    if (!checkIndex(index, QAbstractItemModel::CheckIndexOption::IndexIsValid)) {
+        return {};
+    }
+
+    const bool placeholder = !index.parent().isValid() && isPlaceholder(index.row());
+    if (role == m_placeholderRole) {
+        return placeholder;
+    }
+    return placeholder ? QVariant() : QIdentityProxyModel::data(index, role);
+}
+
+Qt::ItemFlags TablePagingProxyModel::flags(const QModelIndex &index) const
+{
+    if (index.isValid() && !index.parent().isValid() && isPlaceholder(index.row())) {
+        return Qt::ItemNeverHasChildren;
+    }
+    return QIdentityProxyModel::flags(index);
+}
+
+QHash<int, QByteArray> TablePagingProxyModel::roleNames() const
+{
+    auto roles = QIdentityProxyModel::roleNames();
+    roles.insert(m_placeholderRole, QByteArrayLiteral("placeholder"));
+    return roles;
+}
+
+bool TablePagingProxyModel::canFetchMore(const QModelIndex &parent) const
+{
+    Q_UNUSED(parent)
+    return false;
+}
+
+void TablePagingProxyModel::fetchMore(const QModelIndex &parent)
+{
+    Q_UNUSED(parent)
+}
+
+void TablePagingProxyModel::resetInternalData()
+{
+    QIdentityProxyModel::resetInternalData();
+    // Called by endResetModel() before modelReset is emitted, so views asking
+    // for roleNames() again get the new role.
+    updateRole();
+}
+
+void TablePagingProxyModel::updateRole()
+{
+    const auto sourceRoles = sourceModel() ? sourceModel()->roleNames() : QHash<int, QByteArray>();
+    int role = Qt::UserRole + 1;
+    for (auto it = sourceRoles.cbegin(); it != sourceRoles.cend(); ++it) {
+        role = std::max(role, it.key() + 1);
+    }
+    m_placeholderRole = role;
+}
+
+void TablePagingProxyModel::update()
+{
+    if (!sourceModel()) {
+        return;
+    }
+
+    updateResidentRows();
+
+    if (!m_loading && !m_fetchFailed && m_lastVisibleRow + m_fetchAhead >= sourceRowCount() && sourceModel()->canFetchMore({})) {
+        startLoading();
+    }
+}
+
+void TablePagingProxyModel::startLoading()
+{
+    m_loading = true;
+    if (m_placeholderCount > 0) {
+        const int rows = sourceRowCount();
+        beginInsertRows({}, rows, rows + m_placeholderCount - 1);
+        m_shownPlaceholders = m_placeholderCount;
+        endInsertRows();
+    }
+    m_fetchTimer.start();
+    Q_EMIT loadingChanged();
+
+    // Models fetching synchronously insert their rows right away, which ends the loading.
+    sourceModel()->fetchMore({});
+}
+
+void TablePagingProxyModel::finishLoading()
+{
+    if (!m_loading) {
+        return;
+    }
+
+    m_fetchTimer.stop();
+    if (m_shownPlaceholders > 0) {
+        const int rows = sourceRowCount();
+        beginRemoveRows({}, rows, rows + m_shownPlaceholders - 1);
+        m_shownPlaceholders = 0;
+        endRemoveRows();
+    }
+    m_loading = false;
+    Q_EMIT loadingChanged();
+
+    // The new rows may still not reach the visible ones.
+    m_updateTimer.start();
+}
+
+void TablePagingProxyModel::updateResidentRows()
+{
+    if (!m_releasing || m_rowStates.empty()) {
+        return;
+    }
+
+    // A window of rows kept loaded, centered on the visible ones.
+    const int rows = int(m_rowStates.size());
+    const int visible = std::max(m_lastVisibleRow - m_firstVisibleRow + 1, 0);
+    const int capacity = std::max(m_maximumResidentRows, visible);
+    const int first = std::clamp(m_firstVisibleRow - (capacity - visible) / 2, 0, std::max(rows - capacity, 0));
+    const int last = std::min(first + capacity, rows) - 1;
+
+    for (int row = first; row <= last;) {
+        if (m_rowStates[row] != Released) {
+            ++row;
+            continue;
+        }
+        const int runStart = row;
+        while (row <= last && m_rowStates[row] == Released) {
+            ++row;
+        }
+        setRowStates(runStart, row - 1, Requested);
+        QMetaObject::invokeMethod(sourceModel(), "fetchRows", Q_ARG(int, runStart), Q_ARG(int, row - 1));
+    }
+
+    if (m_residentCount <= capacity) {
+        return;
+    }
+
+    const int lastColumn = std::max(columnCount() - 1, 0);
+    const auto release = [this, lastColumn](int from, int to) {
+        for (int row = from; row <= to;) {
+            if (m_rowStates[row] != Resident) {
+                ++row;
+                continue;
+            }
+            const int runStart = row;
+            while (row <= to && m_rowStates[row] == Resident) {
+                ++row;
+            }
+            setRowStates(runStart, row - 1, Released);
+            QMetaObject::invokeMethod(sourceModel(), "releaseRows", Q_ARG(int, runStart), Q_ARG(int, row - 1));
+            Q_EMIT dataChanged(index(runStart, 0), index(row - 1, lastColumn));
+        }
+    };
+    release(0, first - 1);
+    release(last + 1, rows - 1);
+}
+
+void TablePagingProxyModel::setRowStates(int first, int last, RowState state)
+{
+    for (int row = first; row <= last; ++row) {
+        m_residentCount += (state == Resident) - (m_rowStates[row] == Resident);
+        m_rowStates[row] = state;
+    }
+}
+
+void TablePagingProxyModel::sourceRowsInserted(const QModelIndex &parent, int first, int last)
+{
+    if (parent.isValid()) {
+        return;
+    }
+
+    if (m_releasing) {
+        m_rowStates.insert(m_rowStates.begin() + first, last - first + 1, Resident);
+        m_residentCount += last - first + 1;
+    }
+    // Rows arriving after all can be followed by more.
+    m_fetchFailed = false;
+
+    if (m_loading) {
+        finishLoading();
+    } else {
+        m_updateTimer.start();
+    }
+}
+
+void TablePagingProxyModel::sourceRowsRemoved(const QModelIndex &parent, int first, int last)
+{
+    if (parent.isValid() || !m_releasing) {
+        return;
+    }
+
+    for (int row = first; row <= last; ++row) {
+        m_residentCount -= m_rowStates[row] == Resident;
+    }
+    m_rowStates.erase(m_rowStates.begin() + first, m_rowStates.begin() + last + 1);
+    m_updateTimer.start();
+}
+
+void TablePagingProxyModel::sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight)
+{
+    if (!m_releasing || !topLeft.isValid() || topLeft.parent().isValid()) {
+        return;
+    }
+
+    // Requested rows are back, the forwarded change was still hiding their data.
+    const int lastColumn = std::max(columnCount() - 1, 0);
+    for (int row = topLeft.row(); row <= bottomRight.row();) {
+        if (m_rowStates[row] != Requested) {
+            ++row;
+            continue;
+        }
+        const int runStart = row;
+        while (row <= bottomRight.row() && m_rowStates[row] == Requested) {
+            ++row;
+        }
+        setRowStates(runStart, row - 1, Resident);
+        Q_EMIT dataChanged(index(runStart, 0), index(row - 1, lastColumn));
+    }
+}
+
+void TablePagingProxyModel::sourceLayoutChanged()
+{
+    if (!m_releasing || m_rowStates.empty()) {
+        return;
+    }
+
+    // Which rows hold data is unknown after a sort, ask the source again for the rows around the view.
+    std::fill(m_rowStates.begin(), m_rowStates.end(), Released);
+    m_residentCount = 0;
+    Q_EMIT dataChanged(index(0, 0), index(int(m_rowStates.size()) - 1, std::max(columnCount() - 1, 0)));
+    m_updateTimer.start();
+}
+
+void TablePagingProxyModel::sourceAboutToBeReset()
+{
+    // QIdentityProxyModel began resetting the proxy, the placeholders go with the rows.
+    m_shownPlaceholders = 0;
+}
+
+void TablePagingProxyModel::sourceReset()
+{
+    const bool wasLoading = m_loading;
+    m_loading = false;
+    m_fetchFailed = false;
+    m_fetchTimer.stop();
+
+    m_rowStates.assign(m_releasing ? sourceRowCount() : 0, Resident);
+    m_residentCount = int(m_rowStates.size());
+
+    if (wasLoading) {
+        Q_EMIT loadingChanged();
+    }
+    m_updateTimer.start();
+}
+
+#include "moc_tablepagingproxymodel.cpp"
@@ -0,0 +1,172 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QIdentityProxyModel>
+#include <QTimer>
+
+#include <vector>
+
+/**
+ * @brief Loads the rows of a model page by page as the view scrolls.
+ *
+ * When the last visible row gets within fetchAhead rows of the end,
+ * fetchMore() is called on the source model and placeholderCount placeholder
+ * rows are shown after the last row until the new rows are inserted. Rows
+ * report whether they are placeholders through the placeholder role.
+ *
+ * Models holding too many rows to keep them all in memory can also implement
+ * these invokable methods, to have the data of rows far from the view dropped
+ * and loaded again later:
+ * @code
+ * // May drop the data of the rows, without signalling anything.
+ * Q_INVOKABLE void releaseRows(int first, int last);
+ * // Loads the data of released rows again, and emits dataChanged() for them once done.
+ * Q_INVOKABLE void fetchRows(int first, int last);
+ * @endcode
+ * At most maximumResidentRows rows around the visible ones are then kept
+ * loaded, released rows are placeholders until their data is back.
+ *
+ * Only the direct source model is asked to release rows. Behind a sorting
+ * proxy such as TableSortProxyModel, which needs the data of every row to
+ * sort them and does not forward these methods, all the rows stay loaded.
+ */
+class TablePagingProxyModel : public QIdentityProxyModel
+{
+    Q_OBJECT
+
+    /**
+     * @brief The model to show, anything that is not a QAbstractItemModel is ignored.
+     */
+    Q_PROPERTY(QVariant model READ model WRITE setModel NOTIFY sourceModelChanged)
+
+    /**
+     * @brief The rows currently shown by the view.
+     */
+    Q_PROPERTY(int firstVisibleRow READ firstVisibleRow WRITE setFirstVisibleRow NOTIFY visibleRowsChanged)
+    Q_PROPERTY(int lastVisibleRow READ lastVisibleRow WRITE setLastVisibleRow NOTIFY visibleRowsChanged)
+
+    /**
+     * @brief How close to the end the view gets before more rows are fetched, default 50.
+     */
+    Q_PROPERTY(int fetchAhead READ fetchAhead WRITE setFetchAhead NOTIFY fetchAheadChanged)
+
+    /**
+     * @brief The number of placeholder rows shown while fetching, default 3.
+     */
+    Q_PROPERTY(int placeholderCount READ placeholderCount WRITE setPlaceholderCount NOTIFY placeholderCountChanged)
+
+    /**
+     * @brief How long to wait for rows after fetchMore() before giving up, in milliseconds, default 10000.
+     *
+     * After giving up, fetchMore() is only called again once the visible rows
+     * change or the source inserts rows.
+     */
+    Q_PROPERTY(int fetchTimeout READ fetchTimeout WRITE setFetchTimeout NOTIFY fetchTimeoutChanged)
+
+    /**
+     * @brief The number of rows kept loaded with models able to release rows, 0 for no limit.
+     */
+    Q_PROPERTY(int maximumResidentRows READ maximumResidentRows WRITE setMaximumResidentRows NOTIFY maximumResidentRowsChanged)
+
+    /**
+     * @brief Whether rows are being fetched at the end of the model.
+     */
+    Q_PROPERTY(bool loading READ isLoading NOTIFY loadingChanged)
+
+public:
+    explicit TablePagingProxyModel(QObject *parent = nullptr);
+
+    QVariant model() const;
+    void setModel(const QVariant &model);
+
+    int firstVisibleRow() const;
+    void setFirstVisibleRow(int firstVisibleRow);
+
+    int lastVisibleRow() const;
+    void setLastVisibleRow(int lastVisibleRow);
+
+    int fetchAhead() const;
+    void setFetchAhead(int fetchAhead);
+
+    int placeholderCount() const;
+    void setPlaceholderCount(int placeholderCount);
+
+    int fetchTimeout() const;
+    void setFetchTimeout(int fetchTimeout);
+
+    int maximumResidentRows() const;
+    void setMaximumResidentRows(int maximumResidentRows);
+
+    bool isLoading() const;
+
+    void setSourceModel(QAbstractItemModel *sourceModel) override;
+
+    QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override;
+    QModelIndex parent(const QModelIndex &child) const override;
+    QModelIndex sibling(int row, int column, const QModelIndex &idx) const override;
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QModelIndex mapToSource(const QModelIndex &proxyIndex) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex &index) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    // The view asks for more rows through the visible rows, not on its own.
+    bool canFetchMore(const QModelIndex &parent) const override;
+    void fetchMore(const QModelIndex &parent) override;
+
+Q_SIGNALS:
+    void visibleRowsChanged();
+    void fetchAheadChanged();
+    void placeholderCountChanged();
+    void fetchTimeoutChanged();
+    void maximumResidentRowsChanged();
+    void loadingChanged();
+
+protected Q_SLOTS:
+    void resetInternalData() override;
+
+private:
+    enum RowState : quint8 {
+        Resident,
+        Released,
+        Requested, // released, and asked back from the source
+    };
+
+    int sourceRowCount() const;
+    bool isPlaceholder(int row) const;
+    void updateRole();
+    void update();
+    void startLoading();
+    void finishLoading();
+    void updateResidentRows();
+    void setRowStates(int first, int last, RowState state);
+
+    void sourceRowsInserted(const QModelIndex &parent, int first, int last);
+    void sourceRowsRemoved(const QModelIndex &parent, int first, int last);
+    void sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight);
+    void sourceLayoutChanged();
+    void sourceAboutToBeReset();
+    void sourceReset();
+
+    int m_firstVisibleRow = 0;
+    int m_lastVisibleRow = -1;
+    int m_fetchAhead = 50;
+    int m_placeholderCount = 3;
+    int m_maximumResidentRows = 0;
+    int m_placeholderRole = Qt::UserRole + 1;
+
+    bool m_loading = false;
+    bool m_fetchFailed = false; // the last fetch timed out
+    int m_shownPlaceholders = 0; // placeholder rows currently after the source rows
+    QTimer m_updateTimer; // coalesces visible row changes
+    QTimer m_fetchTimer; // gives up on a fetch that never delivers
+
+    bool m_releasing = false; // whether maximumResidentRows applies to the source
+    std::vector<RowState> m_rowStates; // per source row, while m_releasing
+    int m_residentCount = 0;
+};
@@ -0,0 +1,185 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "tableselectionhelper.h"
+
+#include <algorithm>
+
+TableSelectionHelper::TableSelectionHelper(QObject *parent)
+    : QObject(parent)
+{
+}
+
+QItemSelectionModel *TableSelectionHelper::selectionModel() const
+{
+    return m_selectionModel;
+}
+
+void TableSelectionHelper::setSelectionModel(QItemSelectionModel *selectionModel)
+{
+    if (m_selectionModel == selectionModel) {
+        return;
+    }
+    m_selectionModel = selectionModel;
+    m_anchor = {};
+    Q_EMIT selectionModelChanged();
+}
+
+int TableSelectionHelper::selectionBehavior() const
+{
+    return m_selectionBehavior;
+}
+
+void TableSelectionHelper::setSelectionBehavior(int selectionBehavior)
+{
+    if (m_selectionBehavior == selectionBehavior) {
+        return;
+    }
+    m_selectionBehavior = selectionBehavior;
+    Q_EMIT selectionBehaviorChanged();
+}
+
+int TableSelectionHelper::selectionMode() const
+{
+    return m_selectionMode;
+}
+
+void TableSelectionHelper::setSelectionMode(int selectionMode)
+{
+    if (m_selectionMode == selectionMode) {
+        return;
+    }
+    m_selectionMode = selectionMode;
+    Q_EMIT selectionModeChanged();
+}
+
+QItemSelectionModel::SelectionFlags TableSelectionHelper::behaviorFlags() const
+{
+    switch (m_selectionBehavior) {
+    case SelectRows:
+        return QItemSelectionModel::Rows;
+    case SelectColumns:
+        return QItemSelectionModel::Columns;
+    default:
+        return QItemSelectionModel::NoUpdate;
+    }
+}
+
+void TableSelectionHelper::selectCell(int row, int column, int modifiers)
+{
+    if (!m_selectionModel || !m_selectionModel->model()) {
+        return;
+    }
+    select(m_selectionModel->model()->index(row, column), Qt::KeyboardModifiers(modifiers), behaviorFlags());
+}
+
+void TableSelectionHelper::selectRow(int row, int modifiers)
+{
+    if (!m_selectionModel || !m_selectionModel->model()) {
+        return;
+    }
+    const int column = std::max(m_selectionModel->currentIndex().column(), 0);
+    select(m_selectionModel->model()->index(row, column), Qt::KeyboardModifiers(modifiers), QItemSelectionModel::Rows);
+}
+
+void TableSelectionHelper::selectColumn(int column, int modifiers)
+{
+    if (!m_selectionModel || !m_selectionModel->model()) {
+        return;
+    }
+    const int row = std::max(m_selectionModel->currentIndex().row(), 0);
+    select(m_selectionModel->model()->index(row, column), Qt::KeyboardModifiers(modifiers), QItemSelectionModel::Columns);
+}
+
+void TableSelectionHelper::select(const QModelIndex &target, Qt::KeyboardModifiers modifiers, QItemSelectionModel::SelectionFlags behaviorFlags)
+{
+    if (!target.isValid() || m_selectionBehavior == SelectionDisabled) {
+        return;
+    }
+
+    const bool multiple = m_selectionMode != SingleSelection;
+    const bool toggle = m_selectionMode == ExtendedSelection && modifiers.testFlag(Qt::ControlModifier);
+    const bool extend = multiple && modifiers.testFlag(Qt::ShiftModifier) && m_anchor.isValid() && m_anchor.model() == target.model();
+
+    if (extend) {
+        const QAbstractItemModel *model = target.model();
+        const QModelIndex topLeft = model->index(std::min(m_anchor.row(), target.row()), std::min(m_anchor.column(), target.column()));
+        const QModelIndex bottomRight = model->index(std::max(m_anchor.row(), target.row()), std::max(m_anchor.column(), target.column()));
+
+        // One range however large the block is, expanded to rows or columns by the flags.
+        const QItemSelection selection(topLeft, bottomRight);
+        m_selectionModel->select(selection, (toggle ? QItemSelectionModel::Select : QItemSelectionModel::ClearAndSelect) | behaviorFlags);
+        m_selectionModel->setCurrentIndex(target, QItemSelectionModel::NoUpdate);
+        return;
+    }
+
+    m_anchor = target;
+
+    if (toggle) {
+        m_selectionModel->setCurrentIndex(target, QItemSelectionModel::Toggle | behaviorFlags);
+        if (!m_selectionModel->hasSelection()) {
+            m_selectionModel->clearSelection();
+            m_selectionModel->clearCurrentIndex();
+        }
+        return;
+    }
+
+    m_selectionModel->setCurrentIndex(target, QItemSelectionModel::ClearAndSelect | behaviorFlags);
+}
+
+bool TableSelectionHelper::moveCurrent(int rowDelta, int columnDelta, int modifiers)
+{
+    if (!m_selectionModel || !m_selectionModel->model() || m_selectionBehavior == SelectionDisabled) {
+        return false;
+    }
+
+    const QAbstractItemModel *model = m_selectionModel->model();
+    const int rowCount = model->rowCount();
+    const int columnCount = model->columnCount();
+    if (rowCount == 0 || columnCount == 0) {
+        return false;
+    }
+
+    const QModelIndex current = m_selectionModel->currentIndex();
+    const int row = current.isValid() ? std::clamp(current.row() + rowDelta, 0, rowCount - 1) : 0;
+    const int column = current.isValid() ? std::clamp(current.column() + columnDelta, 0, columnCount - 1) : 0;
+    if (current.isValid() && row == current.row() && column == current.column()) {
+        return false;
+    }
+
+    const QModelIndex target = model->index(row, column);
+    const auto keyboardModifiers = Qt::KeyboardModifiers(modifiers);
+
+    if (keyboardModifiers.testFlag(Qt::ControlModifier) && !keyboardModifiers.testFlag(Qt::ShiftModifier)
+        && m_selectionMode == ExtendedSelection) {
+        // Move the focus only, Ctrl+Space or a Ctrl click toggles it afterwards.
+        m_selectionModel->setCurrentIndex(target, QItemSelectionModel::NoUpdate);
+        return true;
+    }
+
+    if (!m_anchor.isValid() && current.isValid()) {
+        m_anchor = current;
+    }
+    select(target, keyboardModifiers & Qt::ShiftModifier, behaviorFlags());
+    return true;
+}
+
+void TableSelectionHelper::selectAll()
+{
+    if (!m_selectionModel || !m_selectionModel->model() || m_selectionBehavior == SelectionDisabled || m_selectionMode == SingleSelection) {
+        return;
+    }
+
+    const QAbstractItemModel *model = m_selectionModel->model();
+    if (model->rowCount() == 0 || model->columnCount() == 0) {
+        return;
+    }
+
+    const QItemSelection selection(model->index(0, 0), model->index(model->rowCount() - 1, model->columnCount() - 1));
+    m_selectionModel->select(selection, QItemSelectionModel::ClearAndSelect);
+}
+
+#include "moc_tableselectionhelper.cpp"
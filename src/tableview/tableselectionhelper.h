@@ -0,0 +1,102 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QItemSelectionModel>
+#include <QObject>
+#include <QPersistentModelIndex>
+#include <QPointer>
+
+/**
+ * @brief Applies mouse and keyboard selection gestures to a QItemSelectionModel.
+ *
+ * Every gesture results in a single QItemSelection made of one range (a cell
+ * block, whole rows or whole columns) applied with one select() call, however
+ * many cells it spans. The cell the last plain or Ctrl click landed on is kept
+ * as the anchor that Shift clicks and Shift arrows extend from.
+ *
+ * Like QAbstractItemView's ExtendedSelection, a Shift click replaces the
+ * selection with the range from the anchor, so that Shift arrows can shrink
+ * it again. Ctrl+Shift adds the range to the selection instead, which is what
+ * a plain Shift click did before this helper existed.
+ *
+ * selectionBehavior and selectionMode take the TableView enum values.
+ */
+class TableSelectionHelper : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(QItemSelectionModel *selectionModel READ selectionModel WRITE setSelectionModel NOTIFY selectionModelChanged)
+    Q_PROPERTY(int selectionBehavior READ selectionBehavior WRITE setSelectionBehavior NOTIFY selectionBehaviorChanged)
+    Q_PROPERTY(int selectionMode READ selectionMode WRITE setSelectionMode NOTIFY selectionModeChanged)
+
+public:
+    // Mirrors of TableView.SelectionBehavior and TableView.SelectionMode
+    enum SelectionBehavior {
+        SelectionDisabled,
+        SelectCells,
+        SelectRows,
+        SelectColumns,
+    };
+    enum SelectionMode {
+        SingleSelection,
+        ContiguousSelection,
+        ExtendedSelection,
+    };
+
+    explicit TableSelectionHelper(QObject *parent = nullptr);
+
+    QItemSelectionModel *selectionModel() const;
+    void setSelectionModel(QItemSelectionModel *selectionModel);
+
+    int selectionBehavior() const;
+    void setSelectionBehavior(int selectionBehavior);
+
+    int selectionMode() const;
+    void setSelectionMode(int selectionMode);
+
+    /**
+     * @brief Handles a click on a cell.
+     *
+     * Without modifiers the cell, or its row or column depending on
+     * selectionBehavior, becomes the selection. Ctrl toggles it, Shift replaces
+     * the selection with everything between the anchor and it, Ctrl+Shift adds
+     * that range to the selection.
+     */
+    Q_INVOKABLE void selectCell(int row, int column, int modifiers = Qt::NoModifier);
+
+    /// Like selectCell() but always selects whole rows.
+    Q_INVOKABLE void selectRow(int row, int modifiers = Qt::NoModifier);
+
+    /// Like selectCell() but always selects whole columns.
+    Q_INVOKABLE void selectColumn(int column, int modifiers = Qt::NoModifier);
+
+    /**
+     * @brief Moves the current index by the given amount of rows and columns.
+     *
+     * The new current cell gets selected, with Shift the selection is extended
+     * from the anchor instead, with Ctrl only the current index moves.
+     *
+     * @return whether the current index moved.
+     */
+    Q_INVOKABLE bool moveCurrent(int rowDelta, int columnDelta, int modifiers = Qt::NoModifier);
+
+    Q_INVOKABLE void selectAll();
+
+Q_SIGNALS:
+    void selectionModelChanged();
+    void selectionBehaviorChanged();
+    void selectionModeChanged();
+
+private:
+    void select(const QModelIndex &target, Qt::KeyboardModifiers modifiers, QItemSelectionModel::SelectionFlags behaviorFlags);
+    QItemSelectionModel::SelectionFlags behaviorFlags() const;
+
+    QPointer<QItemSelectionModel> m_selectionModel;
+    int m_selectionBehavior = SelectRows;
+    int m_selectionMode = ExtendedSelection;
+    QPersistentModelIndex m_anchor;
+};
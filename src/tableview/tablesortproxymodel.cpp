@@ -0,0 +1,722 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "tablesortproxymodel.h"
+
+#include <QDateTime>
+#include <QSemaphore>
+#include <QThread>
+#include <QThreadPool>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <numeric>
+
+namespace
+{
+// Above this many changed rows, a full sort is cheaper than moving rows one by one.
+constexpr int IncrementalUpdateLimit = 64;
+
+// Kept apart from the global pool, whose threads the application may keep busy.
+Q_GLOBAL_STATIC(QThreadPool, sortPool)
+
+std::optional<qint64> toInteger(const QVariant &value)
+{
+    switch (value.metaType().id()) {
+    case QMetaType::Bool:
+    case QMetaType::Char:
+    case QMetaType::SChar:
+    case QMetaType::UChar:
+    case QMetaType::Short:
+    case QMetaType::UShort:
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::Long:
+    case QMetaType::ULong:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+        return value.toLongLong();
+    case QMetaType::QDate:
+        return value.toDate().toJulianDay();
+    case QMetaType::QTime:
+        return value.toTime().msecsSinceStartOfDay();
+    case QMetaType::QDateTime:
+        return value.toDateTime().toMSecsSinceEpoch();
+    default:
+        return std::nullopt;
+    }
+}
+
+bool isReal(const QVariant &value)
+{
+    const int type = value.metaType().id();
+    return type == QMetaType::Double || type == QMetaType::Float || type == QMetaType::Float16;
+}
+
+template<typename T>
+int threeWay(const T &left, const T &right)
+{
+    return left < right ? -1 : (right < left ? 1 : 0);
+}
+}
+
+void TableSortProxyModel::KeyColumn::resize(size_t size)
+{
+    isNull.assign(size, true);
+    integers.clear();
+    reals.clear();
+    strings.clear();
+    switch (kind) {
+    case Integer:
+        integers.resize(size);
+        break;
+    case Real:
+        reals.resize(size);
+        break;
+    case String:
+        strings.resize(size);
+        break;
+    }
+}
+
+void TableSortProxyModel::KeyColumn::insert(size_t position, size_t count)
+{
+    isNull.insert(isNull.begin() + position, count, true);
+    switch (kind) {
+    case Integer:
+        integers.insert(integers.begin() + position, count, 0);
+        break;
+    case Real:
+        reals.insert(reals.begin() + position, count, 0);
+        break;
+    case String:
+        strings.insert(strings.begin() + position, count, std::nullopt);
+        break;
+    }
+}
+
+void TableSortProxyModel::KeyColumn::erase(size_t first, size_t last)
+{
+    isNull.erase(isNull.begin() + first, isNull.begin() + last + 1);
+    switch (kind) {
+    case Integer:
+        integers.erase(integers.begin() + first, integers.begin() + last + 1);
+        break;
+    case Real:
+        reals.erase(reals.begin() + first, reals.begin() + last + 1);
+        break;
+    case String:
+        strings.erase(strings.begin() + first, strings.begin() + last + 1);
+        break;
+    }
+}
+
+int TableSortProxyModel::KeyColumn::compare(int left, int right) const
+{
+    const bool leftNull = isNull[left];
+    const bool rightNull = isNull[right];
+    if (leftNull || rightNull) {
+        // Empty values go first.
+        return int(rightNull) - int(leftNull);
+    }
+
+    switch (kind) {
+    case Integer:
+        return threeWay(integers[left], integers[right]);
+    case Real:
+        return threeWay(reals[left], reals[right]);
+    case String:
+        return strings[left]->compare(*strings[right]);
+    }
+    return 0;
+}
+
+TableSortProxyModel::TableSortProxyModel(QObject *parent)
+    : QAbstractProxyModel(parent)
+{
+    m_collator.setNumericMode(true);
+    m_collator.setCaseSensitivity(Qt::CaseInsensitive);
+}
+
+TableSortProxyModel::~TableSortProxyModel() = default;
+
+QVariant TableSortProxyModel::model() const
+{
+    return QVariant::fromValue(sourceModel());
+}
+
+void TableSortProxyModel::setModel(const QVariant &model)
+{
+    setSourceModel(qobject_cast<QAbstractItemModel *>(model.value<QObject *>()));
+}
+
+int TableSortProxyModel::sortRole() const
+{
+    return m_sortRole;
+}
+
+void TableSortProxyModel::setSortRole(int sortRole)
+{
+    if (m_sortRole == sortRole) {
+        return;
+    }
+    m_sortRole = sortRole;
+    resort();
+    Q_EMIT sortRoleChanged();
+}
+
+Qt::SortOrder TableSortProxyModel::sortOrder() const
+{
+    return m_sortOrder;
+}
+
+void TableSortProxyModel::setSortOrder(Qt::SortOrder sortOrder)
+{
+    if (m_sortOrder == sortOrder) {
+        return;
+    }
+    m_sortOrder = sortOrder;
+    resort();
+    Q_EMIT sortOrderChanged();
+}
+
+QVariantList TableSortProxyModel::secondarySortKeys() const
+{
+    return m_secondarySortKeys;
+}
+
+void TableSortProxyModel::setSecondarySortKeys(const QVariantList &secondarySortKeys)
+{
+    if (m_secondarySortKeys == secondarySortKeys) {
+        return;
+    }
+    m_secondarySortKeys = secondarySortKeys;
+    resort();
+    Q_EMIT secondarySortKeysChanged();
+}
+
+int TableSortProxyModel::sortColumn() const
+{
+    return m_sortColumn;
+}
+
+void TableSortProxyModel::setSortColumn(int sortColumn)
+{
+    if (m_sortColumn == sortColumn) {
+        return;
+    }
+    m_sortColumn = sortColumn;
+    resort();
+    Q_EMIT sortColumnChanged();
+}
+
+int TableSortProxyModel::parallelSortThreshold() const
+{
+    return m_parallelSortThreshold;
+}
+
+void TableSortProxyModel::setParallelSortThreshold(int parallelSortThreshold)
+{
+    if (m_parallelSortThreshold == parallelSortThreshold) {
+        return;
+    }
+    m_parallelSortThreshold = parallelSortThreshold;
+    Q_EMIT parallelSortThresholdChanged();
+}
+
+void TableSortProxyModel::setSourceModel(QAbstractItemModel *sourceModel)
+{
+    if (sourceModel == this->sourceModel()) {
+        return;
+    }
+
+    beginResetModel();
+
+    for (const auto &connection : std::as_const(m_sourceConnections)) {
+        disconnect(connection);
+    }
+    m_sourceConnections.clear();
+
+    QAbstractProxyModel::setSourceModel(sourceModel);
+
+    if (sourceModel) {
+        m_sourceConnections = {
+            connect(sourceModel, &QAbstractItemModel::dataChanged, this, &TableSortProxyModel::sourceDataChanged),
+            connect(sourceModel, &QAbstractItemModel::headerDataChanged, this, &QAbstractItemModel::headerDataChanged),
+            connect(sourceModel, &QAbstractItemModel::rowsInserted, this, &TableSortProxyModel::sourceRowsInserted),
+            connect(sourceModel, &QAbstractItemModel::rowsAboutToBeRemoved, this, &TableSortProxyModel::sourceRowsAboutToBeRemoved),
+            connect(sourceModel, &QAbstractItemModel::rowsRemoved, this, &TableSortProxyModel::sourceRowsRemoved),
+            // Anything changing the structure is rare enough to be handled as a reset.
+            connect(sourceModel, &QAbstractItemModel::modelAboutToBeReset, this, &TableSortProxyModel::sourceAboutToBeReset),
+            connect(sourceModel, &QAbstractItemModel::modelReset, this, &TableSortProxyModel::sourceReset),
+            connect(sourceModel, &QAbstractItemModel::layoutAboutToBeChanged, this, &TableSortProxyModel::sourceAboutToBeReset),
+            connect(sourceModel, &QAbstractItemModel::layoutChanged, this, &TableSortProxyModel::sourceReset),
+            connect(sourceModel, &QAbstractItemModel::rowsAboutToBeMoved, this, &TableSortProxyModel::sourceAboutToBeReset),
+            connect(sourceModel, &QAbstractItemModel::rowsMoved, this, &TableSortProxyModel::sourceReset),
+            connect(sourceModel, &QAbstractItemModel::columnsAboutToBeInserted, this, &TableSortProxyModel::sourceAboutToBeReset),
+            connect(sourceModel, &QAbstractItemModel::columnsInserted, this, &TableSortProxyModel::sourceReset),
+            connect(sourceModel, &QAbstractItemModel::columnsAboutToBeRemoved, this, &TableSortProxyModel::sourceAboutToBeReset),
+            connect(sourceModel, &QAbstractItemModel::columnsRemoved, this, &TableSortProxyModel::sourceReset),
+            connect(sourceModel, &QAbstractItemModel::columnsAboutToBeMoved, this, &TableSortProxyModel::sourceAboutToBeReset),
+            connect(sourceModel, &QAbstractItemModel::columnsMoved, this, &TableSortProxyModel::sourceReset),
+        };
+    }
+
+    buildKeys();
+    sortMapping();
+    rebuildSourceMapping();
+
+    endResetModel();
+}
+
+QModelIndex TableSortProxyModel::index(int row, int column, const QModelIndex &parent) const
+{
+    if (parent.isValid() || row < 0 || row >= rowCount() || column < 0 || column >= columnCount()) {
+        return {};
+    }
+    return createIndex(row, column);
+}
+
+QModelIndex TableSortProxyModel::parent(const QModelIndex &child) const
+{
+    Q_UNUSED(child)
+    return {};
+}
+
+int TableSortProxyModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : int(m_proxyToSource.size());
+}
+
+int TableSortProxyModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() || !sourceModel() ? 0 : sourceModel()->columnCount();
+}
+
+bool TableSortProxyModel::hasChildren(const QModelIndex &parent) const
+{
+    return !parent.isValid() && rowCount() > 0;
+}
+
+QModelIndex TableSortProxyModel::sibling(int row, int column, const QModelIndex &index) const
+{
+    Q_UNUSED(index)
+    return this->index(row, column);
+}
+
+QModelIndex TableSortProxyModel::mapToSource(const QModelIndex &proxyIndex) const
+{
+    if (!sourceModel() || !proxyIndex.isValid() || proxyIndex.row() >= rowCount()) {
+        return {};
+    }
+    return sourceModel()->index(m_proxyToSource[proxyIndex.row()], proxyIndex.column());
+}
+
+QModelIndex TableSortProxyModel::mapFromSource(const QModelIndex &sourceIndex) const
+{
+    if (!sourceIndex.isValid() || sourceIndex.parent().isValid() || size_t(sourceIndex.row()) >= m_sourceToProxy.size()) {
+        return {};
+    }
+    return index(m_sourceToProxy[sourceIndex.row()], sourceIndex.column());
+}
+
+int TableSortProxyModel::mapRowToSource(int row) const
+{
+    return row >= 0 && row < rowCount() ? m_proxyToSource[row] : -1;
+}
+
+int TableSortProxyModel::mapRowFromSource(int sourceRow) const
+{
+    return sourceRow >= 0 && size_t(sourceRow) < m_sourceToProxy.size() ? m_sourceToProxy[sourceRow] : -1;
+}
+
+bool TableSortProxyModel::isSorting() const
+{
+    return !m_keys.empty();
+}
+
+bool TableSortProxyModel::lessThan(int leftSourceRow, int rightSourceRow) const
+{
+    for (const KeyColumn &column : m_keys) {
+        int result = column.compare(leftSourceRow, rightSourceRow);
+        if (result != 0) {
+            return column.order == Qt::AscendingOrder ? result < 0 : result > 0;
+        }
+    }
+    // Keeps the sort stable, and a total order for the merges.
+    return leftSourceRow < rightSourceRow;
+}
+
+void TableSortProxyModel::buildKeys()
+{
+    m_keys.clear();
+    if (!sourceModel() || m_sortRole < 0) {
+        return;
+    }
+
+    m_keys.push_back({m_sortRole, m_sortOrder});
+    for (const QVariant &entry : std::as_const(m_secondarySortKeys)) {
+        const QVariantMap key = entry.toMap();
+        bool ok = false;
+        const int role = key.value(QStringLiteral("role")).toInt(&ok);
+        if (ok && role >= 0) {
+            m_keys.push_back({role, Qt::SortOrder(key.value(QStringLiteral("order"), Qt::AscendingOrder).toInt())});
+        }
+    }
+
+    const int rows = sourceModel()->rowCount();
+    for (KeyColumn &column : m_keys) {
+        // The first value decides how the whole column is compared.
+        column.kind = KeyColumn::String;
+        for (int row = 0; row < rows; ++row) {
+            const QVariant value = sourceModel()->index(row, m_sortColumn).data(column.role);
+            if (!value.isValid() || value.isNull()) {
+                continue;
+            }
+            column.kind = toInteger(value) ? KeyColumn::Integer : isReal(value) ? KeyColumn::Real : KeyColumn::String;
+            break;
+        }
+
+        column.resize(rows);
+        for (int row = 0; row < rows; ++row) {
+            readKey(column, row);
+        }
+    }
+}
+
+void TableSortProxyModel::readKey(KeyColumn &column, int sourceRow) const
+{
+    const QVariant value = sourceModel()->index(sourceRow, m_sortColumn).data(column.role);
+    bool isNull = !value.isValid() || value.isNull();
+
+    if (!isNull) {
+        switch (column.kind) {
+        case KeyColumn::Integer:
+            if (const auto integer = toInteger(value)) {
+                column.integers[sourceRow] = *integer;
+            } else {
+                isNull = true;
+            }
+            break;
+        case KeyColumn::Real: {
+            bool ok = false;
+            column.reals[sourceRow] = value.toDouble(&ok);
+            isNull = !ok;
+            break;
+        }
+        case KeyColumn::String:
+            column.strings[sourceRow] = m_collator.sortKey(value.toString());
+            break;
+        }
+    }
+
+    column.isNull[sourceRow] = isNull;
+}
+
+void TableSortProxyModel::sortMapping()
+{
+    const int rows = sourceModel() ? sourceModel()->rowCount() : 0;
+    m_proxyToSource.resize(rows);
+    std::iota(m_proxyToSource.begin(), m_proxyToSource.end(), 0);
+
+    if (!isSorting() || rows < 2) {
+        return;
+    }
+
+    const auto compare = [this](int left, int right) {
+        return lessThan(left, right);
+    };
+
+    const int chunkCount = std::min(QThread::idealThreadCount(), 8);
+    if (rows < m_parallelSortThreshold || chunkCount < 2) {
+        std::sort(m_proxyToSource.begin(), m_proxyToSource.end(), compare);
+        return;
+    }
+
+    // Sort chunks in parallel, then merge them pairwise.
+    std::vector<int> bounds;
+    for (int chunk = 0; chunk <= chunkCount; ++chunk) {
+        bounds.push_back(int(qint64(rows) * chunk / chunkCount));
+    }
+
+    // The calling thread takes chunks too, so the sort never waits on a pool
+    // that is busy: it only waits for the chunks a worker already started.
+    // Workers that start after every chunk was taken leave without touching
+    // anything but the shared counter.
+    struct Work {
+        std::atomic_int next{0};
+        QSemaphore done;
+    };
+    const auto work = std::make_shared<Work>();
+    const auto sortChunks = [work, chunkCount, first = m_proxyToSource.begin(), bounds, compare] {
+        for (int chunk = work->next++; chunk < chunkCount; chunk = work->next++) {
+            std::sort(first + bounds[chunk], first + bounds[chunk + 1], compare);
+            work->done.release();
+        }
+    };
+    for (int helper = 1; helper < chunkCount; ++helper) {
+        sortPool->start(sortChunks);
+    }
+    sortChunks();
+    work->done.acquire(chunkCount);
+
+    for (size_t width = 1; width < size_t(chunkCount); width *= 2) {
+        for (size_t chunk = 0; chunk + width < size_t(chunkCount); chunk += 2 * width) {
+            const auto begin = m_proxyToSource.begin() + bounds[chunk];
+            const auto middle = m_proxyToSource.begin() + bounds[chunk + width];
+            const auto end = m_proxyToSource.begin() + bounds[std::min(chunk + 2 * width, size_t(chunkCount))];
+            std::inplace_merge(begin, middle, end, compare);
+        }
+    }
+}
+
+void TableSortProxyModel::rebuildSourceMapping(int firstProxyRow, int lastProxyRow)
+{
+    // Sized by the source, rows being inserted are not in the proxy yet.
+    m_sourceToProxy.resize(sourceModel() ? sourceModel()->rowCount() : 0);
+    if (lastProxyRow < 0) {
+        lastProxyRow = int(m_proxyToSource.size()) - 1;
+    }
+    for (int row = firstProxyRow; row <= lastProxyRow; ++row) {
+        m_sourceToProxy[m_proxyToSource[row]] = row;
+    }
+}
+
+void TableSortProxyModel::resort()
+{
+    if (!sourceModel()) {
+        return;
+    }
+
+    Q_EMIT layoutAboutToBeChanged({}, QAbstractItemModel::VerticalSortHint);
+
+    const QModelIndexList persistent = persistentIndexList();
+    QList<std::pair<int, int>> sourceCells;
+    sourceCells.reserve(persistent.size());
+    for (const QModelIndex &index : persistent) {
+        sourceCells.append({m_proxyToSource[index.row()], index.column()});
+    }
+
+    buildKeys();
+    sortMapping();
+    rebuildSourceMapping();
+
+    QModelIndexList updated;
+    updated.reserve(persistent.size());
+    for (const auto &[sourceRow, column] : std::as_const(sourceCells)) {
+        updated.append(index(m_sourceToProxy[sourceRow], column));
+    }
+    changePersistentIndexList(persistent, updated);
+
+    Q_EMIT layoutChanged({}, QAbstractItemModel::VerticalSortHint);
+}
+
+void TableSortProxyModel::sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QList<int> &roles)
+{
+    if (m_resetting || !topLeft.isValid() || topLeft.parent().isValid()) {
+        return;
+    }
+
+    const int first = topLeft.row();
+    const int last = bottomRight.row();
+    const int changedRows = last - first + 1;
+
+    // Forward the change first, rows that then move carry their new data with them.
+    if (changedRows > IncrementalUpdateLimit) {
+        Q_EMIT dataChanged(index(0, topLeft.column()), index(rowCount() - 1, bottomRight.column()), roles);
+    } else {
+        for (int row = first; row <= last; ++row) {
+            const int proxyRow = m_sourceToProxy[row];
+            Q_EMIT dataChanged(index(proxyRow, topLeft.column()), index(proxyRow, bottomRight.column()), roles);
+        }
+    }
+
+    if (!isSorting() || m_sortColumn < topLeft.column() || m_sortColumn > bottomRight.column()) {
+        return;
+    }
+    const bool affectsKeys = roles.isEmpty() || std::any_of(m_keys.cbegin(), m_keys.cend(), [&roles](const KeyColumn &column) {
+                                 return roles.contains(column.role);
+                             });
+    if (!affectsKeys) {
+        return;
+    }
+
+    if (changedRows > IncrementalUpdateLimit) {
+        resort();
+        return;
+    }
+
+    const auto compare = [this](int left, int right) {
+        return lessThan(left, right);
+    };
+
+    // One row at a time, so that all the others are in order when looking for its new place.
+    for (int sourceRow = first; sourceRow <= last; ++sourceRow) {
+        for (KeyColumn &column : m_keys) {
+            readKey(column, sourceRow);
+        }
+
+        const int from = m_sourceToProxy[sourceRow];
+        m_proxyToSource.erase(m_proxyToSource.begin() + from);
+        const int to = int(std::lower_bound(m_proxyToSource.begin(), m_proxyToSource.end(), sourceRow, compare) - m_proxyToSource.begin());
+        m_proxyToSource.insert(m_proxyToSource.begin() + from, sourceRow);
+
+        if (to == from) {
+            continue;
+        }
+
+        // Qt wants the destination in the numbering from before the move.
+        beginMoveRows({}, from, from, {}, to > from ? to + 1 : to);
+        m_proxyToSource.erase(m_proxyToSource.begin() + from);
+        m_proxyToSource.insert(m_proxyToSource.begin() + to, sourceRow);
+        rebuildSourceMapping(std::min(from, to), std::max(from, to));
+        endMoveRows();
+    }
+}
+
+void TableSortProxyModel::sourceRowsInserted(const QModelIndex &parent, int first, int last)
+{
+    if (m_resetting || parent.isValid()) {
+        return;
+    }
+
+    const int count = last - first + 1;
+    for (KeyColumn &column : m_keys) {
+        column.insert(first, count);
+        for (int row = first; row <= last; ++row) {
+            readKey(column, row);
+        }
+    }
+    for (int &sourceRow : m_proxyToSource) {
+        if (sourceRow >= first) {
+            sourceRow += count;
+        }
+    }
+
+    if (!isSorting()) {
+        beginInsertRows({}, first, last);
+        m_proxyToSource.insert(m_proxyToSource.begin() + first, count, 0);
+        std::iota(m_proxyToSource.begin() + first, m_proxyToSource.end(), first);
+        rebuildSourceMapping();
+        endInsertRows();
+        return;
+    }
+
+    const auto compare = [this](int left, int right) {
+        return lessThan(left, right);
+    };
+
+    if (count <= IncrementalUpdateLimit) {
+        for (int sourceRow = first; sourceRow <= last; ++sourceRow) {
+            const int to = int(std::lower_bound(m_proxyToSource.begin(), m_proxyToSource.end(), sourceRow, compare) - m_proxyToSource.begin());
+            beginInsertRows({}, to, to);
+            m_proxyToSource.insert(m_proxyToSource.begin() + to, sourceRow);
+            rebuildSourceMapping();
+            endInsertRows();
+        }
+        return;
+    }
+
+    // Append the whole batch, then sort it in with a single layout change.
+    const int end = rowCount();
+    beginInsertRows({}, end, end + count - 1);
+    for (int sourceRow = first; sourceRow <= last; ++sourceRow) {
+        m_proxyToSource.push_back(sourceRow);
+    }
+    rebuildSourceMapping();
+    endInsertRows();
+
+    Q_EMIT layoutAboutToBeChanged({}, QAbstractItemModel::VerticalSortHint);
+    const QModelIndexList persistent = persistentIndexList();
+    QList<std::pair<int, int>> sourceCells;
+    for (const QModelIndex &index : persistent) {
+        sourceCells.append({m_proxyToSource[index.row()], index.column()});
+    }
+    std::sort(m_proxyToSource.begin(), m_proxyToSource.end(), compare);
+    rebuildSourceMapping();
+    QModelIndexList updated;
+    for (const auto &[sourceRow, column] : std::as_const(sourceCells)) {
+        updated.append(index(m_sourceToProxy[sourceRow], column));
+    }
+    changePersistentIndexList(persistent, updated);
+    Q_EMIT layoutChanged({}, QAbstractItemModel::VerticalSortHint);
+}
+
+void TableSortProxyModel::sourceRowsAboutToBeRemoved(const QModelIndex &parent, int first, int last)
+{
+    if (m_resetting || parent.isValid()) {
+        return;
+    }
+
+    // The proxy rows of the removed source rows, as contiguous spans removed from the bottom up.
+    std::vector<int> proxyRows;
+    proxyRows.reserve(last - first + 1);
+    for (int sourceRow = first; sourceRow <= last; ++sourceRow) {
+        proxyRows.push_back(m_sourceToProxy[sourceRow]);
+    }
+    std::sort(proxyRows.begin(), proxyRows.end(), std::greater<int>());
+
+    size_t spanStart = 0;
+    while (spanStart < proxyRows.size()) {
+        size_t spanEnd = spanStart;
+        while (spanEnd + 1 < proxyRows.size() && proxyRows[spanEnd + 1] == proxyRows[spanEnd] - 1) {
+            ++spanEnd;
+        }
+
+        const int top = proxyRows[spanEnd];
+        const int bottom = proxyRows[spanStart];
+        beginRemoveRows({}, top, bottom);
+        m_proxyToSource.erase(m_proxyToSource.begin() + top, m_proxyToSource.begin() + bottom + 1);
+        // Only rows below the span moved, the source mapping is fixed up once the source rows are gone.
+        endRemoveRows();
+
+        spanStart = spanEnd + 1;
+    }
+}
+
+void TableSortProxyModel::sourceRowsRemoved(const QModelIndex &parent, int first, int last)
+{
+    if (m_resetting || parent.isValid()) {
+        return;
+    }
+
+    const int count = last - first + 1;
+    for (KeyColumn &column : m_keys) {
+        column.erase(first, last);
+    }
+    for (int &sourceRow : m_proxyToSource) {
+        if (sourceRow > last) {
+            sourceRow -= count;
+        }
+    }
+    rebuildSourceMapping();
+}
+
+void TableSortProxyModel::sourceAboutToBeReset()
+{
+    if (m_resetting) {
+        return;
+    }
+    m_resetting = true;
+    beginResetModel();
+}
+
+void TableSortProxyModel::sourceReset()
+{
+    if (!m_resetting) {
+        return;
+    }
+
+    buildKeys();
+    sortMapping();
+    rebuildSourceMapping();
+
+    m_resetting = false;
+    endResetModel();
+}
+
+#include "moc_tablesortproxymodel.cpp"
@@ -0,0 +1,165 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QAbstractProxyModel>
+#include <QCollator>
+#include <QCollatorSortKey>
+
+#include <optional>
+#include <vector>
+
+/**
+ * @brief Sorts the rows of a flat list or table model by one or more roles.
+ *
+ * The values of the sort roles are read once per row and turned into typed
+ * keys (integers, floating point numbers or collation keys for strings), which
+ * are then compared directly instead of going through QVariant. Ties are
+ * broken by source row, so the sort is stable. Large models are sorted in
+ * parallel chunks that are merged afterwards.
+ *
+ * Changes to a few rows only move those rows to their new place; larger
+ * changes trigger a full sort.
+ *
+ * Only top level rows are sorted, child rows of tree models are not shown.
+ */
+class TableSortProxyModel : public QAbstractProxyModel
+{
+    Q_OBJECT
+
+    /**
+     * @brief The model to sort, anything that is not a QAbstractItemModel is ignored.
+     */
+    Q_PROPERTY(QVariant model READ model WRITE setModel NOTIFY sourceModelChanged)
+
+    /**
+     * @brief The role to sort by, -1 keeps the source order.
+     */
+    Q_PROPERTY(int sortRole READ sortRole WRITE setSortRole NOTIFY sortRoleChanged)
+
+    Q_PROPERTY(Qt::SortOrder sortOrder READ sortOrder WRITE setSortOrder NOTIFY sortOrderChanged)
+
+    /**
+     * @brief Roles used to order rows that are equal for sortRole, in order of precedence.
+     *
+     * Each entry is an object with a role and an optional order, e.g.
+     * `[{ role: MyModel.NameRole, order: Qt.AscendingOrder }]`.
+     */
+    Q_PROPERTY(QVariantList secondarySortKeys READ secondarySortKeys WRITE setSecondarySortKeys NOTIFY secondarySortKeysChanged)
+
+    /**
+     * @brief The column whose data is sorted, for table models.
+     */
+    Q_PROPERTY(int sortColumn READ sortColumn WRITE setSortColumn NOTIFY sortColumnChanged)
+
+    /**
+     * @brief Row count from which the sort is spread over several threads, default 50000.
+     */
+    Q_PROPERTY(int parallelSortThreshold READ parallelSortThreshold WRITE setParallelSortThreshold NOTIFY parallelSortThresholdChanged)
+
+public:
+    explicit TableSortProxyModel(QObject *parent = nullptr);
+    ~TableSortProxyModel() override;
+
+    QVariant model() const;
+    void setModel(const QVariant &model);
+
+    int sortRole() const;
+    void setSortRole(int sortRole);
+
+    Qt::SortOrder sortOrder() const;
+    void setSortOrder(Qt::SortOrder sortOrder);
+
+    QVariantList secondarySortKeys() const;
+    void setSecondarySortKeys(const QVariantList &secondarySortKeys);
+
+    int sortColumn() const;
+    void setSortColumn(int sortColumn);
+
+    int parallelSortThreshold() const;
+    void setParallelSortThreshold(int parallelSortThreshold);
+
+    void setSourceModel(QAbstractItemModel *sourceModel) override;
+
+    QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override;
+    QModelIndex parent(const QModelIndex &child) const override;
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    bool hasChildren(const QModelIndex &parent = QModelIndex()) const override;
+    QModelIndex sibling(int row, int column, const QModelIndex &index) const override;
+    QModelIndex mapToSource(const QModelIndex &proxyIndex) const override;
+    QModelIndex mapFromSource(const QModelIndex &sourceIndex) const override;
+
+    /**
+     * @brief The source row shown at @p row.
+     */
+    Q_INVOKABLE int mapRowToSource(int row) const;
+
+    /**
+     * @brief The row at which @p sourceRow is shown.
+     */
+    Q_INVOKABLE int mapRowFromSource(int sourceRow) const;
+
+Q_SIGNALS:
+    void sortRoleChanged();
+    void sortOrderChanged();
+    void secondarySortKeysChanged();
+    void sortColumnChanged();
+    void parallelSortThresholdChanged();
+
+private:
+    // The cached values of one sort role, in source row order.
+    struct KeyColumn {
+        enum Kind {
+            Integer,
+            Real,
+            String,
+        };
+
+        int role = -1;
+        Qt::SortOrder order = Qt::AscendingOrder;
+        Kind kind = String;
+        std::vector<bool> isNull;
+        std::vector<qint64> integers;
+        std::vector<double> reals;
+        std::vector<std::optional<QCollatorSortKey>> strings;
+
+        void resize(size_t size);
+        void insert(size_t position, size_t count);
+        void erase(size_t first, size_t last);
+        int compare(int left, int right) const;
+    };
+
+    bool isSorting() const;
+    bool lessThan(int leftSourceRow, int rightSourceRow) const;
+
+    void buildKeys();
+    void readKey(KeyColumn &column, int sourceRow) const;
+    void sortMapping();
+    void rebuildSourceMapping(int firstProxyRow = 0, int lastProxyRow = -1);
+    void resort();
+
+    void sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QList<int> &roles);
+    void sourceRowsInserted(const QModelIndex &parent, int first, int last);
+    void sourceRowsAboutToBeRemoved(const QModelIndex &parent, int first, int last);
+    void sourceRowsRemoved(const QModelIndex &parent, int first, int last);
+    void sourceAboutToBeReset();
+    void sourceReset();
+
+    int m_sortRole = -1;
+    Qt::SortOrder m_sortOrder = Qt::AscendingOrder;
+    QVariantList m_secondarySortKeys;
+    int m_sortColumn = 0;
+    int m_parallelSortThreshold = 50000;
+
+    QCollator m_collator;
+    std::vector<KeyColumn> m_keys;
+    std::vector<int> m_proxyToSource;
+    std::vector<int> m_sourceToProxy;
+    QList<QMetaObject::Connection> m_sourceConnections;
+    bool m_resetting = false; // a reset started in a source "about to" signal
+};
@@ -0,0 +1,409 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "tabletextcell.h"
+
+#include <QFontMetricsF>
+#include <QQuickWindow>
+#include <QSGRectangleNode>
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 7, 0)
+#include <QSGTextNode>
+#include <QTextLayout>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace
+{
+class CellNode : public QSGNode
+{
+public:
+    QSGRectangleNode *background = nullptr;
+    QSGRectangleNode *borders[4] = {}; // left, top, right, bottom
+    QSGNode *text = nullptr;
+};
+}
+
+TableTextCell::TableTextCell(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+    setFlag(ItemHasContents);
+    setAcceptHoverEvents(true);
+}
+
+QString TableTextCell::text() const
+{
+    return m_text;
+}
+
+void TableTextCell::setText(const QString &text)
+{
+    if (m_text == text) {
+        return;
+    }
+    m_text = text;
+    relayout();
+    Q_EMIT textChanged();
+}
+
+QFont TableTextCell::font() const
+{
+    return m_font;
+}
+
+void TableTextCell::setFont(const QFont &font)
+{
+    if (m_font == font) {
+        return;
+    }
+    m_font = font;
+    relayout();
+    Q_EMIT fontChanged();
+}
+
+qreal TableTextCell::leftPadding() const
+{
+    return m_leftPadding;
+}
+
+void TableTextCell::setLeftPadding(qreal leftPadding)
+{
+    if (qFuzzyCompare(m_leftPadding, leftPadding)) {
+        return;
+    }
+    m_leftPadding = leftPadding;
+    relayout();
+    Q_EMIT leftPaddingChanged();
+}
+
+qreal TableTextCell::rightPadding() const
+{
+    return m_rightPadding;
+}
+
+void TableTextCell::setRightPadding(qreal rightPadding)
+{
+    if (qFuzzyCompare(m_rightPadding, rightPadding)) {
+        return;
+    }
+    m_rightPadding = rightPadding;
+    relayout();
+    Q_EMIT rightPaddingChanged();
+}
+
+bool TableTextCell::isMirrored() const
+{
+    return m_mirrored;
+}
+
+void TableTextCell::setMirrored(bool mirrored)
+{
+    if (m_mirrored == mirrored) {
+        return;
+    }
+    m_mirrored = mirrored;
+    relayout();
+    Q_EMIT mirroredChanged();
+}
+
+bool TableTextCell::drawsText() const
+{
+#if QT_VERSION >= QT_VERSION_CHECK(6, 7, 0)
+    return true;
+#else
+    return false;
+#endif
+}
+
+QColor TableTextCell::textColor() const
+{
+    return m_textColor;
+}
+
+void TableTextCell::setTextColor(const QColor &color)
+{
+    setColor(m_textColor, color, !m_highlighted);
+}
+
+QColor TableTextCell::highlightedTextColor() const
+{
+    return m_highlightedTextColor;
+}
+
+void TableTextCell::setHighlightedTextColor(const QColor &color)
+{
+    setColor(m_highlightedTextColor, color, m_highlighted);
+}
+
+QColor TableTextCell::backgroundColor() const
+{
+    return m_backgroundColor;
+}
+
+void TableTextCell::setBackgroundColor(const QColor &color)
+{
+    setColor(m_backgroundColor, color, false);
+}
+
+QColor TableTextCell::highlightColor() const
+{
+    return m_highlightColor;
+}
+
+void TableTextCell::setHighlightColor(const QColor &color)
+{
+    setColor(m_highlightColor, color, false);
+}
+
+QColor TableTextCell::hoverColor() const
+{
+    return m_hoverColor;
+}
+
+void TableTextCell::setHoverColor(const QColor &color)
+{
+    setColor(m_hoverColor, color, false);
+}
+
+QColor TableTextCell::borderColor() const
+{
+    return m_borderColor;
+}
+
+void TableTextCell::setBorderColor(const QColor &color)
+{
+    setColor(m_borderColor, color, false);
+}
+
+void TableTextCell::setColor(QColor &member, const QColor &color, bool affectsText)
+{
+    if (member == color) {
+        return;
+    }
+    member = color;
+    m_textDirty = m_textDirty || affectsText;
+    update();
+    Q_EMIT colorsChanged();
+}
+
+bool TableTextCell::isHighlighted() const
+{
+    return m_highlighted;
+}
+
+void TableTextCell::setHighlighted(bool highlighted)
+{
+    if (m_highlighted == highlighted) {
+        return;
+    }
+    m_highlighted = highlighted;
+    m_textDirty = m_textDirty || m_textColor != m_highlightedTextColor;
+    update();
+    Q_EMIT highlightedChanged();
+}
+
+bool TableTextCell::showBorder() const
+{
+    return m_showBorder;
+}
+
+void TableTextCell::setShowBorder(bool showBorder)
+{
+    if (m_showBorder == showBorder) {
+        return;
+    }
+    m_showBorder = showBorder;
+    update();
+    Q_EMIT showBorderChanged();
+}
+
+bool TableTextCell::isClickable() const
+{
+    return m_clickable;
+}
+
+void TableTextCell::setClickable(bool clickable)
+{
+    if (m_clickable == clickable) {
+        return;
+    }
+    m_clickable = clickable;
+    setAcceptedMouseButtons(clickable ? Qt::LeftButton : Qt::NoButton);
+    Q_EMIT clickableChanged();
+}
+
+bool TableTextCell::isHovered() const
+{
+    return m_hovered;
+}
+
+void TableTextCell::setHovered(bool hovered)
+{
+    if (m_hovered == hovered) {
+        return;
+    }
+    m_hovered = hovered;
+    update();
+    Q_EMIT hoveredChanged();
+}
+
+bool TableTextCell::isTruncated() const
+{
+    return m_truncated;
+}
+
+void TableTextCell::relayout()
+{
+    m_textDirty = true;
+    polish();
+}
+
+void TableTextCell::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size()) {
+        relayout();
+    }
+}
+
+void TableTextCell::updatePolish()
+{
+    // A single line, like the elided Label it replaces.
+    const QString line = m_text.section(QLatin1Char('\n'), 0, 0);
+    const qreal availableWidth = std::max<qreal>(width() - m_leftPadding - m_rightPadding, 0);
+    m_elidedText = QFontMetricsF(m_font).elidedText(line, Qt::ElideRight, availableWidth);
+
+    const bool truncated = m_elidedText != m_text;
+    if (m_truncated != truncated) {
+        m_truncated = truncated;
+        Q_EMIT truncatedChanged();
+    }
+    update();
+}
+
+QSGNode *TableTextCell::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data)
+{
+    Q_UNUSED(data)
+
+    auto node = static_cast<CellNode *>(oldNode);
+    if (!node) {
+        node = new CellNode;
+        node->background = window()->createRectangleNode();
+        node->appendChildNode(node->background);
+    }
+
+    const QRectF rect = boundingRect();
+    QColor background = m_backgroundColor;
+    if (m_highlighted) {
+        background = m_highlightColor;
+    } else if (m_hovered && m_hoverColor.alpha() > 0) {
+        background = m_hoverColor;
+    }
+    node->background->setRect(rect);
+    node->background->setColor(background);
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 7, 0)
+    if (m_textDirty) {
+        m_textDirty = false;
+        if (node->text) {
+            node->removeChildNode(node->text);
+            delete node->text;
+            node->text = nullptr;
+        }
+
+        const QColor color = m_highlighted ? m_highlightedTextColor : m_textColor;
+        if (!m_elidedText.isEmpty() && color.alpha() > 0 && !rect.isEmpty()) {
+            QTextLayout layout(m_elidedText, m_font);
+            layout.beginLayout();
+            QTextLine line = layout.createLine();
+            line.setNumColumns(m_elidedText.size());
+            layout.endLayout();
+
+            // Aligned like a Label: right to left text on the right, flipped again when mirrored.
+            const qreal leftEdge = m_mirrored ? m_rightPadding : m_leftPadding;
+            const qreal rightEdge = m_mirrored ? m_leftPadding : m_rightPadding;
+            const bool rightAligned = m_elidedText.isRightToLeft() != m_mirrored;
+            const qreal x = rightAligned ? width() - rightEdge - line.naturalTextWidth() : leftEdge;
+
+            QSGTextNode *textNode = window()->createTextNode();
+            textNode->setColor(color);
+            textNode->addTextLayout(QPointF(std::round(x), std::round((height() - line.height()) / 2)), &layout);
+            node->text = textNode;
+            node->insertChildNodeAfter(node->text, node->background);
+        }
+    }
+#endif
+
+    // The frame of the current cell, one pixel lines on top of everything else.
+    if (m_showBorder && m_borderColor.alpha() > 0) {
+        const QRectF lines[4] = {
+            {rect.left(), rect.top(), 1, rect.height()},
+            {rect.left(), rect.top(), rect.width(), 1},
+            {rect.right() - 1, rect.top(), 1, rect.height()},
+            {rect.left(), rect.bottom() - 1, rect.width(), 1},
+        };
+        for (int side = 0; side < 4; ++side) {
+            if (!node->borders[side]) {
+                node->borders[side] = window()->createRectangleNode();
+                node->appendChildNode(node->borders[side]);
+            }
+            node->borders[side]->setRect(lines[side]);
+            node->borders[side]->setColor(m_borderColor);
+        }
+    } else {
+        for (QSGRectangleNode *&border : node->borders) {
+            if (border) {
+                node->removeChildNode(border);
+                delete border;
+                border = nullptr;
+            }
+        }
+    }
+
+    return node;
+}
+
+void TableTextCell::mousePressEvent(QMouseEvent *event)
+{
+    m_doubleClicked = false;
+    event->accept();
+}
+
+void TableTextCell::mouseReleaseEvent(QMouseEvent *event)
+{
+    // The release ending a double click is not another click.
+    if (std::exchange(m_doubleClicked, false)) {
+        return;
+    }
+    if (contains(event->position())) {
+        Q_EMIT clicked();
+    }
+}
+
+void TableTextCell::mouseDoubleClickEvent(QMouseEvent *event)
+{
+    Q_UNUSED(event)
+    m_doubleClicked = true;
+    Q_EMIT doubleClicked();
+}
+
+void TableTextCell::hoverEnterEvent(QHoverEvent *event)
+{
+    setHovered(true);
+    // Let the items below, like a row delegate, see the hover as well.
+    event->ignore();
+}
+
+void TableTextCell::hoverLeaveEvent(QHoverEvent *event)
+{
+    setHovered(false);
+    event->ignore();
+}
+
+#include "moc_tabletextcell.cpp"
@@ -0,0 +1,179 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QColor>
+#include <QFont>
+#include <QQuickItem>
+
+/**
+ * @brief A table cell showing one line of elided text, drawn straight into the scene graph.
+ *
+ * Stands in for a Control, a Loader and a Label for columns using the
+ * default item delegate. Draws the background, the selection highlight, the
+ * current cell border and the text with a few scene graph nodes that are only
+ * rebuilt when what they show changes. The glyphs come from the shared glyph
+ * cache of the window.
+ *
+ * Text nodes can only be created from C++ with Qt 6.7 and later. With older
+ * versions drawsText is false and the delegates show the text with a Label,
+ * as a texture per cell would cost more than the Label does.
+ */
+class TableTextCell : public QQuickItem
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QString text READ text WRITE setText NOTIFY textChanged)
+    Q_PROPERTY(QFont font READ font WRITE setFont NOTIFY fontChanged)
+    Q_PROPERTY(qreal leftPadding READ leftPadding WRITE setLeftPadding NOTIFY leftPaddingChanged)
+    Q_PROPERTY(qreal rightPadding READ rightPadding WRITE setRightPadding NOTIFY rightPaddingChanged)
+
+    /**
+     * @brief Whether the cell is laid out from right to left, swapping the paddings and the alignment of the text.
+     *
+     * Right to left text is right aligned on its own, and left aligned when mirrored, like in a Label.
+     */
+    Q_PROPERTY(bool mirrored READ isMirrored WRITE setMirrored NOTIFY mirroredChanged)
+
+    /**
+     * @brief Whether the cell draws its text, false before Qt 6.7.
+     */
+    Q_PROPERTY(bool drawsText READ drawsText CONSTANT)
+
+    Q_PROPERTY(QColor textColor READ textColor WRITE setTextColor NOTIFY colorsChanged)
+    Q_PROPERTY(QColor highlightedTextColor READ highlightedTextColor WRITE setHighlightedTextColor NOTIFY colorsChanged)
+    Q_PROPERTY(QColor backgroundColor READ backgroundColor WRITE setBackgroundColor NOTIFY colorsChanged)
+    Q_PROPERTY(QColor highlightColor READ highlightColor WRITE setHighlightColor NOTIFY colorsChanged)
+    Q_PROPERTY(QColor hoverColor READ hoverColor WRITE setHoverColor NOTIFY colorsChanged)
+    Q_PROPERTY(QColor borderColor READ borderColor WRITE setBorderColor NOTIFY colorsChanged)
+
+    /**
+     * @brief Whether the cell is selected, drawn with highlightColor and highlightedTextColor.
+     */
+    Q_PROPERTY(bool highlighted READ isHighlighted WRITE setHighlighted NOTIFY highlightedChanged)
+
+    /**
+     * @brief Whether the cell is drawn with a borderColor frame, to mark the current cell.
+     */
+    Q_PROPERTY(bool showBorder READ showBorder WRITE setShowBorder NOTIFY showBorderChanged)
+
+    /**
+     * @brief Whether the cell takes mouse clicks, otherwise they go to the items below.
+     */
+    Q_PROPERTY(bool clickable READ isClickable WRITE setClickable NOTIFY clickableChanged)
+
+    Q_PROPERTY(bool hovered READ isHovered NOTIFY hoveredChanged)
+
+    /**
+     * @brief Whether the text had to be elided to fit.
+     */
+    Q_PROPERTY(bool truncated READ isTruncated NOTIFY truncatedChanged)
+
+public:
+    explicit TableTextCell(QQuickItem *parent = nullptr);
+
+    QString text() const;
+    void setText(const QString &text);
+
+    QFont font() const;
+    void setFont(const QFont &font);
+
+    qreal leftPadding() const;
+    void setLeftPadding(qreal leftPadding);
+
+    qreal rightPadding() const;
+    void setRightPadding(qreal rightPadding);
+
+    bool isMirrored() const;
+    void setMirrored(bool mirrored);
+
+    bool drawsText() const;
+
+    QColor textColor() const;
+    void setTextColor(const QColor &color);
+
+    QColor highlightedTextColor() const;
+    void setHighlightedTextColor(const QColor &color);
+
+    QColor backgroundColor() const;
+    void setBackgroundColor(const QColor &color);
+
+    QColor highlightColor() const;
+    void setHighlightColor(const QColor &color);
+
+    QColor hoverColor() const;
+    void setHoverColor(const QColor &color);
+
+    QColor borderColor() const;
+    void setBorderColor(const QColor &color);
+
+    bool isHighlighted() const;
+    void setHighlighted(bool highlighted);
+
+    bool showBorder() const;
+    void setShowBorder(bool showBorder);
+
+    bool isClickable() const;
+    void setClickable(bool clickable);
+
+    bool isHovered() const;
+    bool isTruncated() const;
+
+Q_SIGNALS:
+    void textChanged();
+    void fontChanged();
+    void leftPaddingChanged();
+    void rightPaddingChanged();
+    void mirroredChanged();
+    void colorsChanged();
+    void highlightedChanged();
+    void showBorderChanged();
+    void clickableChanged();
+    void hoveredChanged();
+    void truncatedChanged();
+
+    void clicked();
+    void doubleClicked();
+
+protected:
+    void updatePolish() override;
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) override;
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+    void mouseDoubleClickEvent(QMouseEvent *event) override;
+    void hoverEnterEvent(QHoverEvent *event) override;
+    void hoverLeaveEvent(QHoverEvent *event) override;
+
+private:
+    void setColor(QColor &member, const QColor &color, bool affectsText);
+    void setHovered(bool hovered);
+    void relayout();
+
+    QString m_text;
+    QString m_elidedText; // what is drawn, computed in updatePolish()
+    QFont m_font;
+    qreal m_leftPadding = 0;
+    qreal m_rightPadding = 0;
+    bool m_mirrored = false;
+
+    QColor m_textColor = Qt::black;
+    QColor m_highlightedTextColor = Qt::white;
+    QColor m_backgroundColor = Qt::transparent;
+    QColor m_highlightColor = Qt::transparent;
+    QColor m_hoverColor = Qt::transparent;
+    QColor m_borderColor = Qt::transparent;
+
+    bool m_highlighted = false;
+    bool m_showBorder = false;
+    bool m_clickable = false;
+    bool m_hovered = false;
+    bool m_truncated = false;
+    bool m_doubleClicked = false; // until the release that ends the double click
+    bool m_textDirty = true; // the text node has to be rebuilt
+};
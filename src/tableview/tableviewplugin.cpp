@@ -7,6 +7,15 @@
 #include <QQmlEngine>
 #include <QQmlExtensionPlugin>
 
+#include "rowselectionproxymodel.h"
+#include "tablecolumnmeasurer.h"
+#include "tablecolumnmodel.h"
+#include "tablecolumnorderproxymodel.h"
+#include "tablepagingproxymodel.h"
+#include "tableselectionhelper.h"
+#include "tablesortproxymodel.h"
+#include "tabletextcell.h"
+
 class TableViewPlugin : public QQmlExtensionPlugin
 {
     Q_OBJECT
@@ -19,6 +28,14 @@ public:
     {
         Q_ASSERT(QLatin1String(uri) == QLatin1String("org.kde.lingmouiaddons.tableview"));
         qmlRegisterModule(uri, 1, 0);
+        qmlRegisterType<TableColumnModel>(uri, 1, 0, "TableColumnModel");
+        qmlRegisterType<TableColumnMeasurer>(uri, 1, 0, "TableColumnMeasurer");
+        qmlRegisterType<TableSelectionHelper>(uri, 1, 0, "TableSelectionHelper");
+        qmlRegisterType<TableTextCell>(uri, 1, 0, "TableTextCell");
+        qmlRegisterType<RowSelectionProxyModel>(uri, 1, 0, "RowSelectionProxyModel");
+        qmlRegisterType<TableColumnOrderProxyModel>(uri, 1, 0, "TableColumnOrderProxyModel");
+        qmlRegisterType<TablePagingProxyModel>(uri, 1, 0, "TablePagingProxyModel");
+        qmlRegisterType<TableSortProxyModel>(uri, 1, 0, "TableSortProxyModel");
     }
 };
 
@@ -10,6 +10,7 @@ import QtQuick.Controls 2.2 as QQC2
 import QtQuick.Templates 2.2 as T2
 import org.kde.kitemmodels 1.0
 import org.kde.lingmoui 2.14 as LingmoUI
+import org.kde.lingmouiaddons.treeview as TreeView
 
 /**
  * The tree expander decorator for item views.
@@ -18,8 +19,13 @@ import org.kde.lingmoui 2.14 as LingmoUI
  * depending on the level of the tree the item is in
  *
  * It is recommanded to directly use RoundedTreeDelegate instead of this component.
+ *
+ * The guides and the expander are drawn by a single TreeLinePainter, so rows
+ * cost the same whatever their depth.
  */
-RowLayout {
+TreeView.TreeLinePainter {
+    id: decoration
+
     /**
      * This property holds the delegate there this decoration will live in.
      * It needs to be assigned explicitly by the developer.
@@ -35,7 +41,7 @@ RowLayout {
     /**
      * This property holds the color of the decoration highlight.
      */
-    property color decorationHighlightColor
+    property color decorationHighlightColor: LingmoUI.Theme.highlightColor
 
     /**
      * This property holds the index of the item.
@@ -74,78 +80,25 @@ RowLayout {
 
     Layout.topMargin: -parentDelegate.topPadding
     Layout.bottomMargin: -parentDelegate.bottomPadding
-    Repeater {
-        model: kDescendantLevel - 1
-        delegate: Item {
-            Layout.preferredWidth: controlRoot.width
-            Layout.fillHeight: true
+    Layout.preferredWidth: implicitWidth
+    Layout.fillHeight: true
+
+    level: kDescendantLevel
+    hasSiblings: kDescendantHasSiblings
+    expandable: kDescendantExpandable
+    expanded: kDescendantExpanded
+
+    indentation: LingmoUI.Units.gridUnit
+    expanderSize: LingmoUI.Units.iconSizes.small
+    mirrored: Qt.application.layoutDirection === Qt.RightToLeft
+    lineColor: Qt.alpha(LingmoUI.Theme.textColor, 0.5)
+    expanderColor: expanderHovered ? decorationHighlightColor : LingmoUI.Theme.textColor
+    Behavior on expanderColor { ColorAnimation { duration: LingmoUI.Units.shortDuration; easing.type: Easing.InOutQuad } }
+
+    // Stands for the expander button the decoration used to have.
+    Accessible.role: Accessible.Button
+    Accessible.ignored: !kDescendantExpandable
+    Accessible.onPressAction: model.toggleChildren(parentDelegate.index)
 
-            Rectangle {
-                anchors {
-                    horizontalCenter: parent.horizontalCenter
-                    top: parent.top
-                    bottom: parent.bottom
-                }
-                visible: kDescendantHasSiblings[modelData]
-                color: LingmoUI.Theme.textColor
-                opacity: 0.5
-                width: 1
-            }
-        }
-    }
-    T2.Button {
-        id: controlRoot
-        Layout.preferredWidth: LingmoUI.Units.gridUnit
-        Layout.fillHeight: true
-        enabled: kDescendantExpandable
-        onClicked: model.toggleChildren(parentDelegate.index)
-        contentItem: Item {
-            id: styleitem
-            implicitWidth: LingmoUI.Units.gridUnit
-            Rectangle {
-                anchors {
-                    horizontalCenter: parent.horizontalCenter
-                    top: parent.top
-                    bottom: expander.visible ? expander.top : parent.verticalCenter
-                }
-                color: LingmoUI.Theme.textColor
-                opacity: 0.5
-                width: 1
-            }
-            LingmoUI.Icon {
-                id: expander
-                anchors.centerIn: parent
-                width: LingmoUI.Units.iconSizes.small
-                height: width
-                source: kDescendantExpanded ? "go-down-symbolic" : (Qt.application.layoutDirection == Qt.RightToLeft ? "go-previous-symbolic" : "go-next-symbolic")
-                isMask: true
-                color: controlRoot.hovered ? decorationLayout.decorationHighlightColor ? decorationLayout.decorationHighlightColor : LingmoUI.Theme.highlightColor : LingmoUI.Theme.textColor
-                LingmoUI.Theme.highlightColor : LingmoUI.Theme.textColor
-                Behavior on color { ColorAnimation { duration: LingmoUI.Units.shortDuration; easing.type: Easing.InOutQuad } }
-                visible: kDescendantExpandable
-            }
-            Rectangle {
-                anchors {
-                    horizontalCenter: parent.horizontalCenter
-                    top: expander.visible ? expander.bottom : parent.verticalCenter
-                    bottom: parent.bottom
-                }
-                visible: kDescendantHasSiblings[kDescendantHasSiblings.length - 1]
-                color: LingmoUI.Theme.textColor
-                opacity: 0.5
-                width: 1
-            }
-            Rectangle {
-                anchors {
-                    verticalCenter: parent.verticalCenter
-                    left: expander.visible ? expander.right : parent.horizontalCenter
-                    right: parent.right
-                }
-                color: LingmoUI.Theme.textColor
-                opacity: 0.5
-                height: 1
-            }
-        }
-        background: Item {}
-    }
+    onExpanderClicked: model.toggleChildren(parentDelegate.index)
 }
@@ -0,0 +1,316 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "treeexpansionhelper.h"
+
+#include <QDebug>
+
+#include <algorithm>
+
+TreeExpansionHelper::TreeExpansionHelper(QObject *parent)
+    : QObject(parent)
+{
+    // Runs the next batch once the views had a chance to process the previous one.
+    m_batchTimer.setSingleShot(true);
+    m_batchTimer.setInterval(0);
+    connect(&m_batchTimer, &QTimer::timeout, this, &TreeExpansionHelper::processBatch);
+}
+
+QAbstractItemModel *TreeExpansionHelper::model() const
+{
+    return m_model;
+}
+
+void TreeExpansionHelper::setModel(QAbstractItemModel *model)
+{
+    if (m_model == model) {
+        return;
+    }
+
+    stop(true);
+    if (m_model) {
+        disconnect(m_model, nullptr, this, nullptr);
+    }
+    m_model = model;
+
+    if (m_model) {
+        // Rows handled so far mean nothing after a change the helper did not make.
+        const auto cancelOperation = [this] {
+            if (!m_changingModel) {
+                stop(true);
+            }
+        };
+        connect(m_model, &QAbstractItemModel::modelReset, this, cancelOperation);
+        connect(m_model, &QAbstractItemModel::layoutChanged, this, cancelOperation);
+        connect(m_model, &QAbstractItemModel::rowsInserted, this, cancelOperation);
+        connect(m_model, &QAbstractItemModel::rowsRemoved, this, cancelOperation);
+        connect(m_model, &QAbstractItemModel::rowsMoved, this, cancelOperation);
+        connect(m_model, &QAbstractItemModel::modelReset, this, &TreeExpansionHelper::updateRoles);
+    }
+
+    updateRoles();
+    Q_EMIT modelChanged();
+}
+
+int TreeExpansionHelper::batchSize() const
+{
+    return m_batchSize;
+}
+
+void TreeExpansionHelper::setBatchSize(int batchSize)
+{
+    batchSize = std::max(batchSize, 1);
+    if (m_batchSize == batchSize) {
+        return;
+    }
+    m_batchSize = batchSize;
+    Q_EMIT batchSizeChanged();
+}
+
+bool TreeExpansionHelper::isBusy() const
+{
+    return m_operation != Operation::None;
+}
+
+qreal TreeExpansionHelper::progress() const
+{
+    return m_progress;
+}
+
+void TreeExpansionHelper::expandAll()
+{
+    stop(true);
+    if (!m_model) {
+        return;
+    }
+
+    resetExpansion(true);
+    Q_EMIT finished();
+}
+
+void TreeExpansionHelper::collapseAll()
+{
+    stop(true);
+    if (!m_model) {
+        return;
+    }
+
+    resetExpansion(false);
+    Q_EMIT finished();
+}
+
+void TreeExpansionHelper::expandToDepth(int depth)
+{
+    stop(true);
+    if (!m_model) {
+        return;
+    }
+
+    resetExpansion(true);
+    m_depth = std::max(depth, 0) + 1; // top level rows have a level of 1
+    start(Operation::CollapseAtDepth, 0, m_model->rowCount() - 1);
+}
+
+void TreeExpansionHelper::expandSubtree(int row)
+{
+    stop(true);
+    if (!m_model || row < 0 || row >= m_model->rowCount()) {
+        return;
+    }
+
+    start(Operation::Expand, row, row);
+}
+
+void TreeExpansionHelper::collapseSubtree(int row)
+{
+    stop(true);
+    if (!m_model || row < 0 || row >= m_model->rowCount()) {
+        return;
+    }
+
+    // Walking up from the last row, each node only hides its children, its own descendants are already collapsed.
+    const int rootLevel = level(row);
+    const int rowCount = m_model->rowCount();
+    int last = row;
+    while (last + 1 < rowCount && level(last + 1) > rootLevel) {
+        ++last;
+    }
+    start(Operation::Collapse, row, last);
+}
+
+void TreeExpansionHelper::cancel()
+{
+    stop(true);
+}
+
+int TreeExpansionHelper::roleValue(int row, int role) const
+{
+    return m_model->index(row, 0).data(role).toInt();
+}
+
+int TreeExpansionHelper::level(int row) const
+{
+    return roleValue(row, m_levelRole);
+}
+
+bool TreeExpansionHelper::isExpandable(int row) const
+{
+    return roleValue(row, m_expandableRole) != 0;
+}
+
+bool TreeExpansionHelper::isExpanded(int row) const
+{
+    return roleValue(row, m_expandedRole) != 0;
+}
+
+void TreeExpansionHelper::setExpanded(int row, bool expanded)
+{
+    // The rows inserted or removed by the model are expected.
+    m_changingModel = true;
+    QMetaObject::invokeMethod(m_model, expanded ? "expandChildren" : "collapseChildren", Q_ARG(int, row));
+    m_changingModel = false;
+}
+
+void TreeExpansionHelper::resetExpansion(bool expanded)
+{
+    if (!m_model) {
+        return;
+    }
+
+    // Changing expandsByDefault forgets the state of every node, with one reset. When it
+    // already has the wanted value, it is flipped twice, which still beats a change per node.
+    m_changingModel = true;
+    if (m_model->property("expandsByDefault").toBool() == expanded) {
+        m_model->setProperty("expandsByDefault", !expanded);
+    }
+    m_model->setProperty("expandsByDefault", expanded);
+    m_changingModel = false;
+}
+
+void TreeExpansionHelper::start(Operation operation, int first, int last)
+{
+    if (m_levelRole < 0 || m_expandableRole < 0 || m_expandedRole < 0) {
+        qWarning() << "TreeExpansionHelper: the model does not have the roles of a KDescendantsProxyModel";
+        return;
+    }
+
+    m_operation = operation;
+    m_first = first;
+    m_last = last;
+    m_row = operation == Operation::Collapse ? last : first;
+    m_rootLevel = level(first);
+    setProgress(0);
+    Q_EMIT busyChanged();
+
+    processBatch();
+}
+
+void TreeExpansionHelper::processBatch()
+{
+    if (m_operation == Operation::None || !m_model) {
+        return;
+    }
+
+    for (int handled = 0; handled < m_batchSize; ++handled) {
+        switch (m_operation) {
+        case Operation::CollapseAtDepth:
+            if (m_row >= m_model->rowCount()) {
+                stop(false);
+                return;
+            }
+            // Deeper rows are skipped over, once the node above them is collapsed they are gone.
+            if (level(m_row) == m_depth && isExpanded(m_row)) {
+                setExpanded(m_row, false);
+            }
+            ++m_row;
+            break;
+        case Operation::Expand:
+            if (m_row >= m_model->rowCount() || (m_row > m_first && level(m_row) <= m_rootLevel)) {
+                stop(false);
+                return;
+            }
+            // The children show up right below, and are handled next.
+            if (isExpandable(m_row) && !isExpanded(m_row)) {
+                setExpanded(m_row, true);
+            }
+            ++m_row;
+            break;
+        case Operation::Collapse:
+            if (m_row < m_first) {
+                stop(false);
+                return;
+            }
+            if (isExpanded(m_row)) {
+                setExpanded(m_row, false);
+            }
+            --m_row;
+            break;
+        case Operation::None:
+            return;
+        }
+    }
+
+    const int rowCount = m_model->rowCount();
+    if (m_operation == Operation::Collapse) {
+        setProgress(qreal(m_last - m_row) / (m_last - m_first + 1));
+    } else if (rowCount > 0) {
+        // The total grows while expanding, so this is only an estimate.
+        setProgress(qreal(m_row) / rowCount);
+    }
+    m_batchTimer.start();
+}
+
+void TreeExpansionHelper::stop(bool canceled)
+{
+    if (m_operation == Operation::None) {
+        return;
+    }
+
+    m_operation = Operation::None;
+    m_batchTimer.stop();
+    if (!canceled) {
+        setProgress(1);
+    }
+    Q_EMIT busyChanged();
+
+    if (canceled) {
+        Q_EMIT this->canceled();
+    } else {
+        Q_EMIT finished();
+    }
+}
+
+void TreeExpansionHelper::setProgress(qreal progress)
+{
+    if (qFuzzyCompare(m_progress, progress)) {
+        return;
+    }
+    m_progress = progress;
+    Q_EMIT progressChanged();
+}
+
+void TreeExpansionHelper::updateRoles()
+{
+    m_levelRole = -1;
+    m_expandableRole = -1;
+    m_expandedRole = -1;
+    if (!m_model) {
+        return;
+    }
+
+    const auto roles = m_model->roleNames();
+    for (auto it = roles.cbegin(); it != roles.cend(); ++it) {
+        if (it.value() == "kDescendantLevel") {
+            m_levelRole = it.key();
+        } else if (it.value() == "kDescendantExpandable") {
+            m_expandableRole = it.key();
+        } else if (it.value() == "kDescendantExpanded") {
+            m_expandedRole = it.key();
+        }
+    }
+}
+
+#include "moc_treeexpansionhelper.cpp"
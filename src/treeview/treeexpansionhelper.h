@@ -0,0 +1,149 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QAbstractItemModel>
+#include <QPointer>
+#include <QTimer>
+
+/**
+ * @brief Expands or collapses many nodes of a KDescendantsProxyModel at once.
+ *
+ * Expanding or collapsing everything goes through the expandsByDefault
+ * property of the model, which resets it once instead of inserting or
+ * removing the rows of each node. Expanding down to a depth starts from
+ * everything expanded and collapses the nodes at that depth, which removes
+ * their descendants in one range each.
+ *
+ * Operations on a subtree expand or collapse its nodes one by one, batchSize
+ * nodes per event loop iteration so that the application stays responsive.
+ * Long operations report their progress and can be canceled.
+ *
+ * The model is driven through its invokable methods and properties, so any
+ * model with the same API can be used as well.
+ */
+class TreeExpansionHelper : public QObject
+{
+    Q_OBJECT
+
+    /**
+     * @brief The KDescendantsProxyModel to expand and collapse.
+     */
+    Q_PROPERTY(QAbstractItemModel *model READ model WRITE setModel NOTIFY modelChanged)
+
+    /**
+     * @brief How many rows are handled per event loop iteration, default 2000.
+     */
+    Q_PROPERTY(int batchSize READ batchSize WRITE setBatchSize NOTIFY batchSizeChanged)
+
+    /**
+     * @brief Whether an operation is running.
+     */
+    Q_PROPERTY(bool busy READ isBusy NOTIFY busyChanged)
+
+    /**
+     * @brief How far the running operation is, from 0 to 1.
+     */
+    Q_PROPERTY(qreal progress READ progress NOTIFY progressChanged)
+
+public:
+    explicit TreeExpansionHelper(QObject *parent = nullptr);
+
+    QAbstractItemModel *model() const;
+    void setModel(QAbstractItemModel *model);
+
+    int batchSize() const;
+    void setBatchSize(int batchSize);
+
+    bool isBusy() const;
+    qreal progress() const;
+
+    /**
+     * @brief Expands every node, with a single model reset.
+     */
+    Q_INVOKABLE void expandAll();
+
+    /**
+     * @brief Collapses every node, with a single model reset.
+     */
+    Q_INVOKABLE void collapseAll();
+
+    /**
+     * @brief Expands the nodes down to @p depth levels below the top level ones, and collapses the others.
+     *
+     * With a depth of 0 only the top level rows are shown.
+     */
+    Q_INVOKABLE void expandToDepth(int depth);
+
+    /**
+     * @brief Expands the node at @p row and all the nodes below it.
+     */
+    Q_INVOKABLE void expandSubtree(int row);
+
+    /**
+     * @brief Collapses the node at @p row and all the nodes below it.
+     */
+    Q_INVOKABLE void collapseSubtree(int row);
+
+    /**
+     * @brief Stops the running operation, the nodes handled so far keep their new state.
+     */
+    Q_INVOKABLE void cancel();
+
+Q_SIGNALS:
+    void modelChanged();
+    void batchSizeChanged();
+    void busyChanged();
+    void progressChanged();
+
+    /**
+     * @brief Emitted when an operation ran to its end.
+     */
+    void finished();
+
+    /**
+     * @brief Emitted when an operation was stopped by cancel() or by a change of the model the helper did not make.
+     */
+    void canceled();
+
+private:
+    enum class Operation {
+        None,
+        CollapseAtDepth, // walks down, collapsing the expanded nodes at m_depth
+        Expand, // walks down the subtree, expanding collapsed nodes
+        Collapse, // walks up the subtree, collapsing expanded nodes
+    };
+
+    int roleValue(int row, int role) const;
+    int level(int row) const;
+    bool isExpandable(int row) const;
+    bool isExpanded(int row) const;
+    void setExpanded(int row, bool expanded);
+    void resetExpansion(bool expanded);
+
+    void start(Operation operation, int first, int last);
+    void processBatch();
+    void stop(bool canceled);
+    void setProgress(qreal progress);
+    void updateRoles();
+
+    QPointer<QAbstractItemModel> m_model;
+    int m_levelRole = -1;
+    int m_expandableRole = -1;
+    int m_expandedRole = -1;
+
+    int m_batchSize = 2000;
+    Operation m_operation = Operation::None;
+    int m_row = 0; // next row to handle
+    int m_first = 0; // the root of the subtree, or the first row
+    int m_last = 0; // the last row of the subtree, when collapsing
+    int m_rootLevel = 0;
+    int m_depth = 0;
+    qreal m_progress = 0;
+    bool m_changingModel = false; // changes made by the helper itself
+    QTimer m_batchTimer;
+};
@@ -0,0 +1,352 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#include "treelinepainter.h"
+
+#include <QLineF>
+#include <QMouseEvent>
+#include <QSGGeometryNode>
+#include <QSGVertexColorMaterial>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+using Vertex = QSGGeometry::ColoredPoint2D;
+
+Vertex vertex(const QPointF &point, const QColor &color)
+{
+    // The vertex color material takes premultiplied colors.
+    const qreal alpha = color.alphaF();
+    Vertex v;
+    v.set(point.x(),
+          point.y(),
+          uchar(std::lround(color.red() * alpha)),
+          uchar(std::lround(color.green() * alpha)),
+          uchar(std::lround(color.blue() * alpha)),
+          uchar(color.alpha()));
+    return v;
+}
+
+void addQuad(std::vector<Vertex> &vertices, const QPointF &a, const QPointF &b, const QPointF &c, const QPointF &d, const QColor &color)
+{
+    vertices.insert(vertices.end(), {vertex(a, color), vertex(b, color), vertex(c, color), vertex(a, color), vertex(c, color), vertex(d, color)});
+}
+
+void addRect(std::vector<Vertex> &vertices, const QRectF &rect, const QColor &color)
+{
+    if (rect.isEmpty()) {
+        return;
+    }
+    addQuad(vertices, rect.topLeft(), rect.topRight(), rect.bottomRight(), rect.bottomLeft(), color);
+}
+
+void addSegment(std::vector<Vertex> &vertices, const QLineF &line, qreal width, const QColor &color)
+{
+    const QLineF normal = line.normalVector().unitVector();
+    const QPointF offset = (normal.p2() - normal.p1()) * width / 2;
+    addQuad(vertices, line.p1() + offset, line.p2() + offset, line.p2() - offset, line.p1() - offset, color);
+}
+}
+
+TreeLinePainter::TreeLinePainter(QQuickItem *parent)
+    : QQuickItem(parent)
+{
+    setFlag(ItemHasContents);
+    setAcceptHoverEvents(true);
+    updateImplicitWidth();
+}
+
+int TreeLinePainter::level() const
+{
+    return m_level;
+}
+
+void TreeLinePainter::setLevel(int level)
+{
+    if (m_level == level) {
+        return;
+    }
+    m_level = level;
+    updateImplicitWidth();
+    update();
+    Q_EMIT levelChanged();
+}
+
+QVariant TreeLinePainter::hasSiblings() const
+{
+    QVariantList list;
+    list.reserve(m_hasSiblings.size());
+    for (qsizetype i = 0; i < m_hasSiblings.size(); ++i) {
+        list.append(m_hasSiblings.testBit(i));
+    }
+    return list;
+}
+
+void TreeLinePainter::setHasSiblings(const QVariant &hasSiblings)
+{
+    const QVariantList list = hasSiblings.toList();
+    QBitArray bits(list.size());
+    for (qsizetype i = 0; i < list.size(); ++i) {
+        bits.setBit(i, list.at(i).toBool());
+    }
+
+    if (m_hasSiblings == bits) {
+        return;
+    }
+    m_hasSiblings = bits;
+    update();
+    Q_EMIT hasSiblingsChanged();
+}
+
+bool TreeLinePainter::isExpandable() const
+{
+    return m_expandable;
+}
+
+void TreeLinePainter::setExpandable(bool expandable)
+{
+    if (m_expandable == expandable) {
+        return;
+    }
+    m_expandable = expandable;
+    setAcceptedMouseButtons(expandable ? Qt::LeftButton : Qt::NoButton);
+    if (!expandable) {
+        setExpanderHovered(false);
+    }
+    update();
+    Q_EMIT expandableChanged();
+}
+
+bool TreeLinePainter::isExpanded() const
+{
+    return m_expanded;
+}
+
+void TreeLinePainter::setExpanded(bool expanded)
+{
+    if (m_expanded == expanded) {
+        return;
+    }
+    m_expanded = expanded;
+    update();
+    Q_EMIT expandedChanged();
+}
+
+qreal TreeLinePainter::indentation() const
+{
+    return m_indentation;
+}
+
+void TreeLinePainter::setIndentation(qreal indentation)
+{
+    if (qFuzzyCompare(m_indentation, indentation)) {
+        return;
+    }
+    m_indentation = indentation;
+    updateImplicitWidth();
+    update();
+    Q_EMIT indentationChanged();
+}
+
+qreal TreeLinePainter::expanderSize() const
+{
+    return m_expanderSize;
+}
+
+void TreeLinePainter::setExpanderSize(qreal expanderSize)
+{
+    if (qFuzzyCompare(m_expanderSize, expanderSize)) {
+        return;
+    }
+    m_expanderSize = expanderSize;
+    update();
+    Q_EMIT expanderSizeChanged();
+}
+
+QColor TreeLinePainter::lineColor() const
+{
+    return m_lineColor;
+}
+
+void TreeLinePainter::setLineColor(const QColor &color)
+{
+    if (m_lineColor == color) {
+        return;
+    }
+    m_lineColor = color;
+    update();
+    Q_EMIT lineColorChanged();
+}
+
+QColor TreeLinePainter::expanderColor() const
+{
+    return m_expanderColor;
+}
+
+void TreeLinePainter::setExpanderColor(const QColor &color)
+{
+    if (m_expanderColor == color) {
+        return;
+    }
+    m_expanderColor = color;
+    update();
+    Q_EMIT expanderColorChanged();
+}
+
+bool TreeLinePainter::isMirrored() const
+{
+    return m_mirrored;
+}
+
+void TreeLinePainter::setMirrored(bool mirrored)
+{
+    if (m_mirrored == mirrored) {
+        return;
+    }
+    m_mirrored = mirrored;
+    update();
+    Q_EMIT mirroredChanged();
+}
+
+bool TreeLinePainter::isExpanderHovered() const
+{
+    return m_expanderHovered;
+}
+
+void TreeLinePainter::setExpanderHovered(bool hovered)
+{
+    if (m_expanderHovered == hovered) {
+        return;
+    }
+    m_expanderHovered = hovered;
+    Q_EMIT expanderHoveredChanged();
+}
+
+void TreeLinePainter::updateImplicitWidth()
+{
+    setImplicitWidth(std::max(m_level, 1) * m_indentation);
+}
+
+QRectF TreeLinePainter::expanderRect() const
+{
+    const qreal x = (std::max(m_level, 1) - 1) * m_indentation;
+    return QRectF(m_mirrored ? width() - x - m_indentation : x, 0, m_indentation, height());
+}
+
+void TreeLinePainter::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    // Lines run the full height, and mirrored rows are laid out from the right edge.
+    if (newGeometry.size() != oldGeometry.size()) {
+        update();
+    }
+}
+
+QSGNode *TreeLinePainter::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data)
+{
+    Q_UNUSED(data)
+
+    auto node = static_cast<QSGGeometryNode *>(oldNode);
+    if (!node) {
+        node = new QSGGeometryNode;
+        node->setGeometry(new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(), 0));
+        node->geometry()->setDrawingMode(QSGGeometry::DrawTriangles);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGVertexColorMaterial);
+        node->setFlag(QSGNode::OwnsMaterial);
+    }
+
+    std::vector<Vertex> vertices;
+    const qreal rowHeight = height();
+    const qreal centerY = std::round(rowHeight / 2);
+    const auto centerX = [this](int level) {
+        return std::floor(level * m_indentation + m_indentation / 2);
+    };
+
+    // Guides of the parent levels that have more children below this row.
+    const int parentLevels = std::max(m_level, 1) - 1;
+    for (int level = 0; level < parentLevels; ++level) {
+        if (level < m_hasSiblings.size() && m_hasSiblings.testBit(level)) {
+            addRect(vertices, QRectF(centerX(level), 0, 1, rowHeight), m_lineColor);
+        }
+    }
+
+    // The branch of the row itself, interrupted by the expander when there is one.
+    const qreal cellRight = (parentLevels + 1) * m_indentation;
+    const qreal x = centerX(parentLevels);
+    const qreal half = m_expandable ? std::round(m_expanderSize / 2) : 0;
+    const bool hasSibling = !m_hasSiblings.isEmpty() && m_hasSiblings.testBit(m_hasSiblings.size() - 1);
+    addRect(vertices, QRectF(x, 0, 1, centerY - half), m_lineColor);
+    if (hasSibling) {
+        addRect(vertices, QRectF(x, centerY + half, 1, rowHeight - centerY - half), m_lineColor);
+    }
+    addRect(vertices, QRectF(x + half, centerY, cellRight - x - half, 1), m_lineColor);
+
+    if (m_expandable) {
+        // A chevron pointing down when expanded, towards the children otherwise.
+        const qreal arm = m_expanderSize / 4;
+        const QPointF center(x + 0.5, centerY + 0.5);
+        QPointF points[3];
+        if (m_expanded) {
+            points[0] = center + QPointF(-arm, -arm / 2);
+            points[1] = center + QPointF(0, arm / 2);
+            points[2] = center + QPointF(arm, -arm / 2);
+        } else {
+            points[0] = center + QPointF(-arm / 2, -arm);
+            points[1] = center + QPointF(arm / 2, 0);
+            points[2] = center + QPointF(-arm / 2, arm);
+        }
+        const qreal thickness = std::max<qreal>(1.5, m_expanderSize / 10);
+        addSegment(vertices, QLineF(points[0], points[1]), thickness, m_expanderColor);
+        addSegment(vertices, QLineF(points[1], points[2]), thickness, m_expanderColor);
+    }
+
+    // Everything is laid out from the left, right to left rows are flipped as a whole.
+    if (m_mirrored) {
+        const float right = float(width());
+        for (Vertex &v : vertices) {
+            v.x = right - v.x;
+        }
+    }
+
+    QSGGeometry *geometry = node->geometry();
+    geometry->allocate(int(vertices.size()));
+    std::copy(vertices.cbegin(), vertices.cend(), geometry->vertexDataAsColoredPoint2D());
+    node->markDirty(QSGNode::DirtyGeometry);
+
+    return node;
+}
+
+void TreeLinePainter::mousePressEvent(QMouseEvent *event)
+{
+    // Clicks outside of the expander go to the delegate below.
+    event->setAccepted(m_expandable && expanderRect().contains(event->position()));
+}
+
+void TreeLinePainter::mouseReleaseEvent(QMouseEvent *event)
+{
+    if (m_expandable && expanderRect().contains(event->position())) {
+        Q_EMIT expanderClicked();
+    }
+}
+
+void TreeLinePainter::hoverMoveEvent(QHoverEvent *event)
+{
+    setExpanderHovered(m_expandable && expanderRect().contains(event->position()));
+    // Let the delegate below see the hover as well.
+    event->ignore();
+}
+
+void TreeLinePainter::hoverLeaveEvent(QHoverEvent *event)
+{
+    setExpanderHovered(false);
+    event->ignore();
+}
+
+#include "moc_treelinepainter.cpp"
@@ -0,0 +1,138 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 agent <agent@local>
+ *
+ *  SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#pragma once
+
+#include <QBitArray>
+#include <QColor>
+#include <QQuickItem>
+
+/**
+ * @brief Draws the indentation guides and the expander of a tree row.
+ *
+ * Everything is drawn by a single geometry node, whatever the depth of the
+ * row, instead of an item per level. The sibling flags of the levels are kept
+ * as a bit array, converted once from the kDescendantHasSiblings list given by
+ * KDescendantsProxyModel.
+ *
+ * Each level takes indentation pixels, the last one holding the expander.
+ */
+class TreeLinePainter : public QQuickItem
+{
+    Q_OBJECT
+
+    /**
+     * @brief The depth of the row, 1 for top level rows, as given by kDescendantLevel.
+     */
+    Q_PROPERTY(int level READ level WRITE setLevel NOTIFY levelChanged)
+
+    /**
+     * @brief Whether each level has more siblings below the row, as given by kDescendantHasSiblings.
+     */
+    Q_PROPERTY(QVariant hasSiblings READ hasSiblings WRITE setHasSiblings NOTIFY hasSiblingsChanged)
+
+    Q_PROPERTY(bool expandable READ isExpandable WRITE setExpandable NOTIFY expandableChanged)
+    Q_PROPERTY(bool expanded READ isExpanded WRITE setExpanded NOTIFY expandedChanged)
+
+    /**
+     * @brief The width of each level.
+     */
+    Q_PROPERTY(qreal indentation READ indentation WRITE setIndentation NOTIFY indentationChanged)
+
+    /**
+     * @brief The size of the square the expander arrow is drawn in.
+     */
+    Q_PROPERTY(qreal expanderSize READ expanderSize WRITE setExpanderSize NOTIFY expanderSizeChanged)
+
+    Q_PROPERTY(QColor lineColor READ lineColor WRITE setLineColor NOTIFY lineColorChanged)
+    Q_PROPERTY(QColor expanderColor READ expanderColor WRITE setExpanderColor NOTIFY expanderColorChanged)
+
+    /**
+     * @brief Whether the row is laid out from right to left.
+     *
+     * The levels then start from the right edge and collapsed expanders point to the left.
+     */
+    Q_PROPERTY(bool mirrored READ isMirrored WRITE setMirrored NOTIFY mirroredChanged)
+
+    /**
+     * @brief Whether the pointer is over the expander of an expandable row.
+     */
+    Q_PROPERTY(bool expanderHovered READ isExpanderHovered NOTIFY expanderHoveredChanged)
+
+public:
+    explicit TreeLinePainter(QQuickItem *parent = nullptr);
+
+    int level() const;
+    void setLevel(int level);
+
+    QVariant hasSiblings() const;
+    void setHasSiblings(const QVariant &hasSiblings);
+
+    bool isExpandable() const;
+    void setExpandable(bool expandable);
+
+    bool isExpanded() const;
+    void setExpanded(bool expanded);
+
+    qreal indentation() const;
+    void setIndentation(qreal indentation);
+
+    qreal expanderSize() const;
+    void setExpanderSize(qreal expanderSize);
+
+    QColor lineColor() const;
+    void setLineColor(const QColor &color);
+
+    QColor expanderColor() const;
+    void setExpanderColor(const QColor &color);
+
+    bool isMirrored() const;
+    void setMirrored(bool mirrored);
+
+    bool isExpanderHovered() const;
+
+Q_SIGNALS:
+    void levelChanged();
+    void hasSiblingsChanged();
+    void expandableChanged();
+    void expandedChanged();
+    void indentationChanged();
+    void expanderSizeChanged();
+    void lineColorChanged();
+    void expanderColorChanged();
+    void mirroredChanged();
+    void expanderHoveredChanged();
+
+    /**
+     * @brief Emitted when the expander of an expandable row is clicked.
+     */
+    void expanderClicked();
+
+protected:
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) override;
+
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+    void hoverMoveEvent(QHoverEvent *event) override;
+    void hoverLeaveEvent(QHoverEvent *event) override;
+
+private:
+    QRectF expanderRect() const;
+    void setExpanderHovered(bool hovered);
+    void updateImplicitWidth();
+
+    int m_level = 1;
+    QBitArray m_hasSiblings; // one bit per level
+    bool m_expandable = false;
+    bool m_expanded = false;
+    qreal m_indentation = 18;
+    qreal m_expanderSize = 16;
+    QColor m_lineColor = Qt::gray;
+    QColor m_expanderColor = Qt::black;
+    bool m_mirrored = false;
+    bool m_expanderHovered = false;
+};
@@ -5,14 +5,26 @@
  */
 
 #include "treeviewplugin.h"
+#include "treeexpansionhelper.h"
+#include "treelinepainter.h"
+#include "treeviewstyles.h"
 
-#include <QFile>
 #include <QQuickStyle>
 
 #include <QQmlEngine>
 
 static QString s_selectedStyle;
 
+static bool hasStyleFile(QStringView style, QStringView fileName)
+{
+    for (const auto &styleFile : s_treeViewStyleFiles) {
+        if (styleFile.style == style && (fileName.isEmpty() || styleFile.fileName == fileName)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 TreeViewPlugin::TreeViewPlugin(QObject *parent)
     : QQmlExtensionPlugin(parent)
 {
@@ -21,10 +33,10 @@ TreeViewPlugin::TreeViewPlugin(QObject *parent)
 
 QUrl TreeViewPlugin::componentUrl(const QString &fileName) const
 {
+    // The table is generated with the module, so there is nothing to look up on disk.
     for (const QString &style : std::as_const(m_stylesFallbackChain)) {
-        const QString candidate = QStringLiteral("styles/") + style + QLatin1Char('/') + fileName;
-        if (QFile::exists(resolveFilePath(candidate))) {
-            return QUrl(resolveFileUrl(candidate));
+        if (!style.isEmpty() && hasStyleFile(style, fileName)) {
+            return QUrl(resolveFileUrl(QStringLiteral("styles/") + style + QLatin1Char('/') + fileName));
         }
     }
 
@@ -39,18 +51,20 @@ void TreeViewPlugin::registerTypes(const char *uri)
 
 #if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS)
     //org.kde.desktop.lingmo is a couple of files that fall back to desktop by purpose
-    if (style.isEmpty() && QFile::exists(resolveFilePath(QStringLiteral("/styles/org.kde.desktop")))) {
+    if (style.isEmpty() && hasStyleFile(u"org.kde.desktop", {})) {
         m_stylesFallbackChain.prepend(QStringLiteral("org.kde.desktop"));
     }
 #endif
 
-    if (!style.isEmpty() && QFile::exists(resolveFilePath(QStringLiteral("/styles/") + style)) && !m_stylesFallbackChain.contains(style)) {
+    if (!style.isEmpty() && hasStyleFile(style, {}) && !m_stylesFallbackChain.contains(style)) {
         m_stylesFallbackChain.prepend(style);
     }
 
     //At this point the fallback chain will be selected->org.kde.desktop->Fallback
     s_selectedStyle = m_stylesFallbackChain.first();
 
+    qmlRegisterType<TreeExpansionHelper>(uri, 1, 0, "TreeExpansionHelper");
+    qmlRegisterType<TreeLinePainter>(uri, 1, 0, "TreeLinePainter");
     qmlRegisterType(componentUrl(QStringLiteral("TreeViewDecoration.qml")), uri, 1, 0, "TreeViewDecoration");
     
 
@@ -19,10 +19,6 @@ public:
 
 private:
     QUrl componentUrl(const QString &fileName) const;
-    QString resolveFilePath(const QString &path) const
-    {
-        return baseUrl().toLocalFile() + QLatin1Char('/') + path;
-    }
     QString resolveFileUrl(const QString &filePath) const
     {
         return baseUrl().toString() + QLatin1Char('/') + filePath;